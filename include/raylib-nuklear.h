@@ -49,6 +49,15 @@
 #define NK_INCLUDE_STANDARD_BOOL
 #define NK_INCLUDE_COMMAND_USERDATA
 #define NK_KEYSTATE_BASED_INPUT
+#ifdef RAYLIB_NUKLEAR_USE_VERTEX_BUFFER
+    #ifndef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+        #define NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+    #endif
+    // Dense interfaces can easily exceed 65535 vertices in a single frame
+    #ifndef NK_UINT_DRAW_INDEX
+        #define NK_UINT_DRAW_INDEX
+    #endif
+#endif
 #ifdef RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT
     #ifndef NK_INCLUDE_FONT_BAKING
         #define NK_INCLUDE_FONT_BAKING
@@ -76,14 +85,124 @@
 extern "C" {
 #endif
 
+/**
+ * Rendering statistics from the last DrawNuklear() call.
+ *
+ * @see GetNuklearRenderStats()
+ */
+typedef struct NuklearRenderStats {
+    unsigned int cacheHits;   // Windows drawn from their cached render texture.
+    unsigned int cacheMisses; // Windows that were rendered into their cached render texture.
+    unsigned int drawCalls;       // Nuklear commands that were submitted to raylib.
+    unsigned int culledCommands;  // Commands that were skipped, as they were outside of the clip rectangle or the screen.
+    unsigned int skippedScissors; // Scissor commands that were skipped, as they matched the active scissor.
+    unsigned int batchFlushes;    // Scissor and render texture changes, each of which flushes raylib's render batch.
+    unsigned int textureSwitches; // Commands that used a different texture than the previous one, splitting raylib's batch.
+    unsigned int culledGlyphs;    // Glyphs of drawn text that were skipped, as they were outside of the clip rectangle.
+} NuklearRenderStats;
+
+/**
+ * The buffers of a Nuklear context that allocate memory.
+ *
+ * @see GetNuklearMemoryStats()
+ */
+typedef enum NuklearMemorySource {
+    NUKLEAR_MEMORY_COMMANDS = 0,   // Nuklear's command buffer.
+    NUKLEAR_MEMORY_POOL,           // The pool pages that hold windows, panels and their state tables.
+    NUKLEAR_MEMORY_TEXT_EDIT,      // Text edits from nk_raylib_textedit_init().
+    NUKLEAR_MEMORY_VERTEX_BUFFERS, // The nk_convert() buffers of DrawNuklearBatched().
+    NUKLEAR_MEMORY_SOURCE_COUNT
+} NuklearMemorySource;
+
+/**
+ * An allocator for the memory of a Nuklear context.
+ *
+ * Nuklear copies a buffer into a new block whenever it grows, unless resize() manages to resize its block in place.
+ *
+ * @see InitNuklearWithAllocator()
+ */
+typedef struct NuklearAllocator {
+    void* userData;                                          // Passed to the callbacks.
+    void* (*alloc)(void* userData, nk_size size);            // Allocate a block of memory, or return NULL when out of memory.
+    bool (*resize)(void* userData, void* ptr, nk_size size); // Grow or shrink a block in place, or return false when it can't. Can be NULL.
+    void (*free)(void* userData, void* ptr);                 // Free a block from alloc().
+} NuklearAllocator;
+
+/**
+ * Memory statistics of a Nuklear context.
+ *
+ * @see GetNuklearMemoryStats()
+ */
+typedef struct NuklearMemoryStats {
+    nk_size arenaSize;   // The size of the memory given to InitNuklearFixed(), or 0 when the context allocates its memory.
+    nk_size arenaUsed;   // The bytes of the arena in use: the context, its user data and font, Nuklear's commands and windows.
+    nk_size arenaPeak;   // The most bytes of the arena that were in use at once, its high-water mark.
+    bool arenaOverflow;  // Whether the arena ran out of memory, dropping the commands or windows that didn't fit.
+    nk_size liveBytes;   // The bytes that are allocated through the context's allocator.
+    nk_size peakBytes;   // The most bytes that were allocated through the context's allocator at once.
+    unsigned int allocations;          // The blocks that were allocated, including the ones that buffers were copied into to grow.
+    unsigned int reallocations;        // The times that a buffer grew or shrank.
+    unsigned int inPlaceReallocations; // The reallocations that NuklearAllocator.resize() did in place, without copying the buffer.
+    unsigned int frameAllocations;     // The blocks that were allocated between the last two calls to DrawNuklear().
+    nk_size commandBufferSize;         // The capacity of Nuklear's command buffer.
+    nk_size commandBufferTarget;       // The capacity that the command buffer is planned to have, from the recent frames' demand.
+    nk_size sourceBytes[NUKLEAR_MEMORY_SOURCE_COUNT];            // The liveBytes of each NuklearMemorySource.
+    unsigned int sourceAllocations[NUKLEAR_MEMORY_SOURCE_COUNT]; // The allocations of each NuklearMemorySource.
+} NuklearMemoryStats;
+
+/**
+ * Flags to change how DrawNuklearEx() draws.
+ *
+ * @see DrawNuklearEx()
+ */
+typedef enum NuklearDrawFlags {
+    NUKLEAR_DRAW_DEFAULT = 0,     // Draw with one raylib call per Nuklear command.
+    NUKLEAR_DRAW_BATCHED = 1 << 0 // Draw through nk_convert() vertex buffers. Requires RAYLIB_NUKLEAR_USE_VERTEX_BUFFER.
+} NuklearDrawFlags;
+
 NK_API struct nk_context* InitNuklear(int fontSize);                // Initialize the Nuklear GUI context using raylib's font
 NK_API struct nk_context* InitNuklearEx(Font font, float fontSize); // Initialize the Nuklear GUI context, with a custom font
 NK_API bool IsNuklearValid(struct nk_context* ctx);                 // Checks if Nuklear was loaded successfully.
 NK_API Font LoadFontFromNuklear(int fontSize);                      // Loads the default Nuklear font
-NK_API void UpdateNuklear(struct nk_context * ctx);                 // Update the input state and internal components for Nuklear
-NK_API void UpdateNuklearEx(struct nk_context * ctx, float deltaTime); // Update the input state and internal components for Nuklear, with a custom frame time
+NK_API bool ExportFontFromNuklearAsCode(const char* fileName);      // Export the decoded default Nuklear font file as code, for RAYLIB_NUKLEAR_DEFAULT_FONT_TTF
+NK_API void UnloadNuklearDefaultFontCache(void);                    // Unload the decoded default Nuklear font file and its baked sizes, which LoadFontFromNuklear() keeps otherwise
+NK_API Font LoadFontFromNuklearCache(const char* cacheFileName, const char* fileName, int fontSize, int* codepoints, int codepointCount); // Load a font like LoadFontEx(), reusing its atlas from a cache file when it was baked before
+NK_API struct nk_user_font* LoadNuklearFont(Font font, float fontSize); // Build a Nuklear font from a raylib font, for nk_style_push_font()
+NK_API void UnloadNuklearFont(struct nk_user_font* userFont);     // Unload a Nuklear font from LoadNuklearFont(), leaving the raylib font loaded
+NK_API struct nk_user_font* ShareNuklearFont(const struct nk_user_font* userFont, float fontSize); // Get another Nuklear font sharing the given font's glyph tables and atlas, for other contexts or sizes
+NK_API struct nk_user_font* LoadNuklearDynamicFont(const char* fileName, float fontSize); // Load a TTF/OTF font that rasterizes glyphs the first time they're used, for large character sets
+NK_API struct nk_user_font* LoadNuklearDynamicFontFromMemory(const unsigned char* fileData, int dataSize, float fontSize); // Load a dynamic font from memory, copying the data
+NK_API struct nk_user_font* LoadNuklearSDFFont(const char* fileName, float fontSize); // Load a signed distance field font, which draws crisp text at any scaling from one atlas
+NK_API struct nk_context* InitNuklearSDF(const char* fileName, float fontSize); // Initialize the Nuklear GUI context with a signed distance field font
+NK_API struct nk_context* InitNuklearFixed(void* memory, nk_size size, int fontSize); // Initialize the Nuklear GUI context inside the given memory, using raylib's font, without allocating
+NK_API struct nk_context* InitNuklearFixedEx(void* memory, nk_size size, Font font, float fontSize); // Initialize the Nuklear GUI context inside the given memory, with a custom font, without allocating
+NK_API struct nk_context* InitNuklearWithAllocator(struct nk_user_font* userFont, const NuklearAllocator* allocator); // Initialize the Nuklear GUI context, allocating its memory with the given allocator
+NK_API struct nk_user_font* GetNuklearFont(struct nk_context* ctx, const char* fileName, float fontSize); // Get a font of the context's font registry, baked at its size times the context's scaling
+NK_API void nk_raylib_text_wrap(struct nk_context *ctx, const char *str, int len); // Same as nk_text_wrap(), keeping the line breaks in a cache so unchanged text isn't measured again
+NK_API void nk_raylib_text_wrap_colored(struct nk_context *ctx, const char *str, int len, struct nk_color color); // Same as nk_text_wrap_colored(), with cached line breaks
+NK_API void nk_raylib_label_wrap(struct nk_context *ctx, const char *str); // Same as nk_label_wrap(), with cached line breaks
+NK_API void nk_raylib_label_colored_wrap(struct nk_context *ctx, const char *str, struct nk_color color); // Same as nk_label_colored_wrap(), with cached line breaks
+NK_API void nk_raylib_textedit_init(struct nk_context *ctx, struct nk_text_edit *box, nk_size size); // Same as nk_textedit_init(), allocating through the context's allocator
+NK_API nk_bool nk_raylib_tree_push_hashed(struct nk_context *ctx, enum nk_tree_type type, const char *title, enum nk_collapse_states initial_state, const char *hash, int len, int seed); // Same as nk_tree_push_hashed(), keeping the tree's state in a hash index. Close it with nk_tree_pop()
+NK_API nk_bool nk_raylib_group_begin_titled(struct nk_context *ctx, const char *name, const char *title, nk_flags flags); // Same as nk_group_begin_titled(), keeping the group's scroll offsets in a hash index. Close it with nk_group_end()
+NK_API nk_bool nk_raylib_group_begin(struct nk_context *ctx, const char *title, nk_flags flags); // Same as nk_group_begin(), keeping the group's scroll offsets in a hash index. Close it with nk_group_end()
+NK_API bool UpdateNuklear(struct nk_context * ctx);                 // Update the input state and internal components for Nuklear, returning whether there was input activity
+NK_API bool UpdateNuklearEx(struct nk_context * ctx, float deltaTime); // Update the input state and internal components for Nuklear, with a custom frame time
+NK_API bool ShouldNuklearRedraw(struct nk_context * ctx);           // Check whether the GUI needs redrawing because of input activity or animations
 NK_API void DrawNuklear(struct nk_context * ctx);                   // Render the Nuklear GUI on the screen
+NK_API void DrawNuklearBatched(struct nk_context * ctx);            // Render the Nuklear GUI through nk_convert() vertex buffers. Requires RAYLIB_NUKLEAR_USE_VERTEX_BUFFER
+NK_API bool DrawNuklearEx(struct nk_context * ctx, unsigned int flags); // Render the Nuklear GUI with NuklearDrawFlags, returning whether the frame changed
+NK_API bool IsNuklearFrameChanged(struct nk_context * ctx);         // Check whether the built GUI differs from the last drawn frame
 NK_API void UnloadNuklear(struct nk_context * ctx);                 // Deinitialize the Nuklear context
+NK_API void SetNuklearWindowCache(struct nk_context * ctx, bool enabled); // Cache unchanged windows in render textures when using DrawNuklear()
+NK_API bool SetNuklearSDFShapes(struct nk_context * ctx, bool enabled); // Draw rounded rectangles, circles and arcs with a signed distance field shader in DrawNuklear()
+NK_API bool SetNuklearAtlas(struct nk_context * ctx, bool enabled); // Pack the font, a white texel for shapes and registered icons into shared texture atlas pages
+NK_API bool AddNuklearAtlasTexture(struct nk_context * ctx, Texture texture); // Register a small texture to be drawn from the texture atlas
+NK_API void RemoveNuklearAtlasTexture(struct nk_context * ctx, Texture texture); // Stop drawing the given texture from the texture atlas
+NK_API NuklearRenderStats GetNuklearRenderStats(struct nk_context * ctx); // Get the rendering statistics from the last DrawNuklear() call
+NK_API NuklearMemoryStats GetNuklearMemoryStats(struct nk_context * ctx); // Get how much memory the context uses, and whether its fixed memory ran out
+NK_API void ReserveNuklearCommandBuffer(struct nk_context * ctx, nk_size size); // Prewarm the command buffer to the given size, and keep it at least that large
+NK_API void SetNuklearCommandBufferShrinkFrames(struct nk_context * ctx, unsigned int frames); // Set how many frames the command buffer has to be oversized before it shrinks, or 0 to never shrink it
 NK_API struct nk_color ColorToNuklearColor(Color color);                 // Convert a raylib Color to a Nuklear color object
 NK_API struct nk_colorf ColorToNuklearColorF(Color color);               // Convert a raylib Color to a Nuklear floating color
 NK_API Color NuklearColorToColor(struct nk_color color);               // Convert a Nuklear color to a raylib Color
@@ -99,9 +218,17 @@ NK_API float GetNuklearScaling(struct nk_context * ctx);            // Retrieves
 NK_API KeyboardKey NuklearKeyToKeyboardKey(nk_rune key);                 // Convert an nk_rune key binding to a raylib KeyboardKey
 NK_API nk_rune KeyboardKeyToNuklearKey(KeyboardKey key);                 // Convert a raylib KeyboardKey to an nk_rune key binding
 
+// Same as nk_tree_push() and nk_tree_push_id(), keeping the tree's state in a hash index. Close them with nk_tree_pop()
+#define nk_raylib_tree_push(ctx, type, title, state) nk_raylib_tree_push_hashed(ctx, type, title, state, NK_FILE_LINE, nk_strlen(NK_FILE_LINE), __LINE__)
+#define nk_raylib_tree_push_id(ctx, type, title, state, id) nk_raylib_tree_push_hashed(ctx, type, title, state, NK_FILE_LINE, nk_strlen(NK_FILE_LINE), id)
+
 // Internal Nuklear functions
 NK_API float nk_raylib_font_get_text_width(nk_handle handle, float height, const char *text, int len);
 NK_API float nk_raylib_font_get_text_width_user_font(nk_handle handle, float height, const char *text, int len);
+#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+NK_API void nk_raylib_font_query_font_glyph(nk_handle handle, float height, struct nk_user_font_glyph *glyph, nk_rune codepoint, nk_rune next_codepoint);
+NK_API void nk_raylib_font_query_font_glyph_user_font(nk_handle handle, float height, struct nk_user_font_glyph *glyph, nk_rune codepoint, nk_rune next_codepoint);
+#endif
 NK_API void nk_raylib_clipboard_paste(nk_handle usr, struct nk_text_edit *edit);
 NK_API void nk_raylib_clipboard_copy(nk_handle usr, const char *text, int len);
 NK_API void* nk_raylib_malloc(nk_handle unused, void *old, nk_size size);
@@ -121,7 +248,9 @@ NK_API void nk_raylib_input_mouse(struct nk_context * ctx);
 #define RAYLIB_NUKLEAR_IMPLEMENTATION_ONCE
 
 #include <stddef.h> // NULL
-#include <math.h> // cosf, sinf, sqrtf
+#include <math.h> // cosf, sinf, sqrtf, acosf, ceilf
+
+#include "rlgl.h" // rlBegin, rlVertex2f, rlTexCoord2f, rlColor4ub, rlSetTexture, rlPushMatrix, rlTranslatef
 
 // Math
 #ifndef NK_COS
@@ -135,7 +264,16 @@ NK_API void nk_raylib_input_mouse(struct nk_context * ctx);
 #endif  // NK_INV_SQRT
 
 #define NK_IMPLEMENTATION
+#if defined(RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT) && defined(__GNUC__)
+// Nuklear's font baking pulls in stb_truetype and stb_rect_pack, which aren't clean under -Wconversion.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wconversion"
+#pragma GCC diagnostic ignored "-Wsign-conversion"
+#endif
 #include "nuklear.h"
+#if defined(RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT) && defined(__GNUC__)
+#pragma GCC diagnostic pop
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -157,753 +295,6773 @@ extern "C" {
 #define RAYLIB_NUKLEAR_FONT_SPACING_RATIO 0.01f
 #endif // RAYLIB_NUKLEAR_FONT_SPACING_RATIO
 
-#ifndef RAYLIB_NUKLEAR_POLYGON_FILL_MAX_POINTS
+#ifndef RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS
 /**
- * The maximum amount of points allowed when drawing a filled polygon.
+ * The amount of segments that nk_convert() uses for circles, arcs and curves in DrawNuklearBatched().
  *
- * @see NK_COMMAND_POLYGON_FILLED
+ * DrawNuklear() picks the amount of segments from the radius instead.
+ *
+ * @see RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE
  */
-#define RAYLIB_NUKLEAR_POLYGON_FILL_MAX_POINTS 64
-#endif  // RAYLIB_NUKLEAR_POLYGON_FILL_MAX_POINTS
+#define RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS 20
+#endif  // RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS
 
-#ifndef RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS
+#ifndef RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE
 /**
- * The amount of segments used when drawing an arc.
+ * The maximum distance, in pixels, between a true circle or curve and the segments that DrawNuklear() draws it with.
  *
- * @see NK_COMMAND_ARC_FILLED
+ * Smaller values draw smoother circles and curves, with more vertices.
  */
-#define RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS 20
-#endif  // RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS
+#define RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE 0.25f
+#endif  // RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE
 
-#ifndef RAYLIB_NUKLEAR_DOUBLE_CLICK_THRESHOLD
+#ifndef RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX
 /**
- * The amount of time required to wait to determine a mouse click as a double click.
+ * The maximum amount of segments for a full circle, which is also the size of the cached unit circle table.
  *
- * @see nk_raylib_input_mouse()
+ * Must be a power of two, and at least 8.
  */
-#define RAYLIB_NUKLEAR_DOUBLE_CLICK_THRESHOLD 0.3
-#endif  // RAYLIB_NUKLEAR_DOUBLE_CLICK_THRESHOLD
+#define RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX 256
+#endif  // RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX
 
+#ifndef RAYLIB_NUKLEAR_CURVE_SEGMENTS_MAX
 /**
- * The user data that's leverages internally through Nuklear.
+ * The maximum amount of segments used to draw a bezier curve.
+ *
+ * @see NK_COMMAND_CURVE
  */
-typedef struct NuklearUserData {
-    float scaling;           // The scaling of the Nuklear user interface.
-    bool insert_mode;        // Whether keyboard insert mode is active.
-    double last_left_press;  // Time of the last left-button press, for double-click detection.
-    bool double_clicking; // Whether a double-click is currently in progress.
-} NuklearUserData;
+#define RAYLIB_NUKLEAR_CURVE_SEGMENTS_MAX 64
+#endif  // RAYLIB_NUKLEAR_CURVE_SEGMENTS_MAX
 
+#ifndef RAYLIB_NUKLEAR_DYNAMIC_FONT_ATLAS_SIZE
 /**
- * Nuklear callback; Get the width of the given text.
+ * The width and height of the glyph atlas of each font from LoadNuklearDynamicFont(), which caps its texture memory.
  *
- * @internal
+ * @see LoadNuklearDynamicFont()
  */
-NK_API float
-nk_raylib_font_get_text_width(nk_handle handle, float height, const char *text, int len)
-{
-    NK_UNUSED(handle);
+#define RAYLIB_NUKLEAR_DYNAMIC_FONT_ATLAS_SIZE 1024
+#endif  // RAYLIB_NUKLEAR_DYNAMIC_FONT_ATLAS_SIZE
 
-    if (len > 0) {
-        Font font = GetFontDefault();
-        if (font.texture.id == 0) return 0;
+#ifndef RAYLIB_NUKLEAR_DYNAMIC_FONT_PAGES
+/**
+ * The amount of pages that the glyph atlas of a dynamic font is split into. When the atlas is full, the least recently
+ * used page is evicted. Glyphs can't be taller than a page.
+ *
+ * @see LoadNuklearDynamicFont()
+ */
+#define RAYLIB_NUKLEAR_DYNAMIC_FONT_PAGES 8
+#endif  // RAYLIB_NUKLEAR_DYNAMIC_FONT_PAGES
 
-        // Match raylib's MeasureText() internal spacing behavior, but use MeasureTextEx()
-        // to avoid int truncation that accumulates errors when measuring character by character.
-        int defaultFontSize = 10;
-        int fontSize = (int)height;
-        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
-        float spacing = (float)(fontSize / defaultFontSize);
+#ifndef RAYLIB_NUKLEAR_SDF_FONT_SIZE
+/**
+ * The size that the glyphs of signed distance field fonts are generated at. Text of any size is drawn from them.
+ *
+ * @see LoadNuklearSDFFont()
+ */
+#define RAYLIB_NUKLEAR_SDF_FONT_SIZE 48
+#endif  // RAYLIB_NUKLEAR_SDF_FONT_SIZE
 
-        // Grab the text with the cropped length so that it only measures the desired string length.
-        const char* subtext = TextSubtext(text, 0, len);
+#ifndef RAYLIB_NUKLEAR_ATLAS_SIZE
+/**
+ * The width and height of each texture atlas page.
+ *
+ * @see SetNuklearAtlas()
+ */
+#define RAYLIB_NUKLEAR_ATLAS_SIZE 1024
+#endif  // RAYLIB_NUKLEAR_ATLAS_SIZE
 
-        // MeasureTextEx adds spacing between characters (len-1 times), but Nuklear expects
-        // one spacing per character, so add one more spacing unit to compensate.
-        return MeasureTextEx(font, subtext, (float)fontSize, spacing).x + spacing;
-    }
+#ifndef RAYLIB_NUKLEAR_ATLAS_PAGES
+/**
+ * The maximum amount of texture atlas pages.
+ *
+ * @see SetNuklearAtlas()
+ */
+#define RAYLIB_NUKLEAR_ATLAS_PAGES 2
+#endif  // RAYLIB_NUKLEAR_ATLAS_PAGES
 
-    return 0;
-}
+#ifndef RAYLIB_NUKLEAR_ATLAS_MAX_IMAGE_SIZE
+/**
+ * The largest width or height of a texture that AddNuklearAtlasTexture() accepts.
+ *
+ * @see AddNuklearAtlasTexture()
+ */
+#define RAYLIB_NUKLEAR_ATLAS_MAX_IMAGE_SIZE 256
+#endif  // RAYLIB_NUKLEAR_ATLAS_MAX_IMAGE_SIZE
 
+#ifndef RAYLIB_NUKLEAR_ATLAS_EVICT_FRAMES
 /**
- * Nuklear callback; Get the width of the given text (userFont version)
+ * The amount of frames that an atlas texture has to go undrawn before it may be evicted to make room for others.
  *
- * @internal
+ * @see AddNuklearAtlasTexture()
  */
-NK_API float
-nk_raylib_font_get_text_width_user_font(nk_handle handle, float height, const char *text, int len)
-{
-    if (len > 0) {
-        // Grab the text with the cropped length so that it only measures the desired string length.
-        const char* subtext = TextSubtext(text, 0, len);
+#define RAYLIB_NUKLEAR_ATLAS_EVICT_FRAMES 120
+#endif  // RAYLIB_NUKLEAR_ATLAS_EVICT_FRAMES
 
-        // Spacing is determined by the font size multiplied by RAYLIB_NUKLEAR_FONT_SPACING_RATIO.
-        // Raylib only counts the spacing between characters, but Nuklear expects one spacing to be
-        // counter for every character in the string:
-        return MeasureTextEx(*(Font*)handle.ptr, subtext, height, height * RAYLIB_NUKLEAR_FONT_SPACING_RATIO).x + height * RAYLIB_NUKLEAR_FONT_SPACING_RATIO;
-    }
+#ifndef RAYLIB_NUKLEAR_DOUBLE_CLICK_THRESHOLD
+/**
+ * The amount of time required to wait to determine a mouse click as a double click.
+ *
+ * @see nk_raylib_input_mouse()
+ */
+#define RAYLIB_NUKLEAR_DOUBLE_CLICK_THRESHOLD 0.3
+#endif  // RAYLIB_NUKLEAR_DOUBLE_CLICK_THRESHOLD
 
-    return 0;
-}
+#ifndef RAYLIB_NUKLEAR_REDRAW_FRAMES
+/**
+ * The amount of frames that ShouldNuklearRedraw() keeps requesting a redraw after the last input activity.
+ *
+ * Nuklear reacts to some input a frame late, so a few extra frames let the GUI settle before going idle.
+ *
+ * @see ShouldNuklearRedraw()
+ */
+#define RAYLIB_NUKLEAR_REDRAW_FRAMES 3
+#endif  // RAYLIB_NUKLEAR_REDRAW_FRAMES
 
+#ifndef RAYLIB_NUKLEAR_COMMAND_HISTORY
 /**
- * Nuklear callback; Paste the current clipboard.
+ * The amount of drawn frames whose command buffer demand is kept, to plan the capacity of the command buffer from.
  *
- * @internal
+ * @see ReserveNuklearCommandBuffer()
  */
-NK_API void
-nk_raylib_clipboard_paste(nk_handle usr, struct nk_text_edit *edit)
-{
-    const char *text = GetClipboardText();
-    NK_UNUSED(usr);
-    if (text != NULL) {
-        nk_textedit_paste(edit, text, (int)TextLength(text));
-    }
-}
+#define RAYLIB_NUKLEAR_COMMAND_HISTORY 64
+#endif  // RAYLIB_NUKLEAR_COMMAND_HISTORY
 
+#ifndef RAYLIB_NUKLEAR_COMMAND_PERCENTILE
 /**
- * Nuklear callback; Copy the given text.
+ * The percentile of the recent command buffer demand that the command buffer is sized for.
  *
- * @internal
+ * Spikes that are rarer than this, like a large popup that was opened once, don't keep the command buffer large.
+ *
+ * @see ReserveNuklearCommandBuffer()
  */
-NK_API void
-nk_raylib_clipboard_copy(nk_handle usr, const char *text, int len)
-{
-    NK_UNUSED(usr);
-    char* trimmedText = (char*)MemAlloc((unsigned int)(sizeof(char) * (size_t)(len + 1)));
-    if(!trimmedText)
-        return;
-    nk_memcopy(trimmedText, text, (nk_size)len);
-    trimmedText[len] = 0;
-    SetClipboardText(trimmedText);
-    MemFree(trimmedText);
-}
+#define RAYLIB_NUKLEAR_COMMAND_PERCENTILE 95
+#endif  // RAYLIB_NUKLEAR_COMMAND_PERCENTILE
 
+#ifndef RAYLIB_NUKLEAR_COMMAND_SHRINK_FRAMES
 /**
- * Nuklear callback; Allocate memory for Nuklear.
+ * The default amount of frames that the command buffer has to be more than twice as large as planned before it shrinks.
  *
- * @internal
+ * @see SetNuklearCommandBufferShrinkFrames()
  */
-NK_API void*
-nk_raylib_malloc(nk_handle unused, void *old, nk_size size)
-{
-    NK_UNUSED(unused);
-    NK_UNUSED(old);
-    return MemAlloc((unsigned int)size);
-}
+#define RAYLIB_NUKLEAR_COMMAND_SHRINK_FRAMES 300
+#endif  // RAYLIB_NUKLEAR_COMMAND_SHRINK_FRAMES
 
 /**
- * Nuklear callback; Free memory for Nuklear.
+ * The glyph index and advance of every codepoint of a font, so that measuring text and querying glyphs doesn't search
+ * the font's glyphs for each codepoint.
+ *
+ * Advances are in the font's pixels, before scaling to the font size.
  */
-NK_API void
-nk_raylib_mfree(nk_handle unused, void *ptr)
-{
-    NK_UNUSED(unused);
-    MemFree(ptr);
-}
+typedef struct NuklearGlyphAdvances {
+    unsigned int texture; // The texture of the font that the advances are for, to notice when it changes.
+    float latin1[256];    // The advances of the codepoints below 256, which most text consists of.
+    int latin1Index[256]; // The glyph indices of the codepoints below 256.
+    float fallback;       // The advance of codepoints the font doesn't have, which raylib draws as '?'.
+    int fallbackIndex;    // The glyph index of codepoints the font doesn't have.
+    float monospace;      // The advance that all glyphs share, or 0 when they differ.
+    int* codepoints;      // Open addressing hash map of the codepoints from 256 up, with 0 for empty slots.
+    float* advances;      // The advances of the codepoints in the hash map.
+    int* indices;         // The glyph indices of the codepoints in the hash map.
+    int mapSize;          // The amount of slots in the hash map, a power of two. 0 when it's empty.
+    int mapCount;         // The amount of codepoints in the hash map.
+    bool search;          // Whether codepoints from 256 up need to be searched for, as the hash map couldn't be made.
+} NuklearGlyphAdvances;
 
 /**
- * Initialize the Nuklear context for use with Raylib, with the given Nuklear user font.
+ * A horizontal band of a dynamic font's glyph atlas, filled by a shelf packer and evicted as a whole.
  *
- * @param userFont The Nuklear user font to initialize the Nuklear context with.
+ * @see LoadNuklearDynamicFont()
+ */
+typedef struct NuklearDynamicFontPage {
+    int shelfX;         // Where the next glyph goes on the current shelf.
+    int shelfY;         // The top of the current shelf, from the top of the page.
+    int shelfHeight;    // The height of the current shelf.
+    unsigned int frame; // The last frame that a glyph of the page was used in.
+} NuklearDynamicFontPage;
+
+/**
+ * The state of a font that rasterizes its glyphs as text needs them.
  *
- * @internal
+ * @see LoadNuklearDynamicFont()
  */
-NK_API struct nk_context*
-InitNuklearContext(struct nk_user_font* userFont)
-{
-    struct nk_context* ctx = (struct nk_context*)MemAlloc(sizeof(struct nk_context));
-    if (ctx == NULL) {
-        TraceLog(LOG_ERROR, "NUKLEAR: Failed to initialize nuklear memory");
-        return NULL;
-    }
+typedef struct NuklearDynamicFont {
+    unsigned char* fileData;  // The font file, kept to rasterize glyphs from.
+    int dataSize;             // The size of the font file.
+    Image image;              // The glyph atlas's pixels, as gray and alpha.
+    int* glyphPages;          // The page of each glyph, -1 when it isn't in the atlas, or -2 when it can't be packed into it.
+    int glyphCapacity;        // The allocated capacity of the font's glyphs, recs and glyphPages.
+    NuklearDynamicFontPage pages[RAYLIB_NUKLEAR_DYNAMIC_FONT_PAGES]; // The pages of the glyph atlas.
+    int dirtyTop;             // The first row of the atlas that changed since it was uploaded.
+    int dirtyBottom;          // The row after the last one that changed. Equal to dirtyTop when nothing changed.
+    unsigned int fullFrame;   // The last frame that a glyph didn't fit into the atlas in, as every page was in use.
+    Texture2D texture;        // The glyph atlas's texture, which is also the font's texture.
+    struct NuklearDynamicFont* next; // The next dynamic font, to upload them all once per frame.
+} NuklearDynamicFont;
 
-    struct NuklearUserData* userData = (struct NuklearUserData*)MemAlloc(sizeof(struct NuklearUserData));
-    if (userData == NULL) {
-        TraceLog(LOG_ERROR, "NUKLEAR: Failed to initialize nuklear user data");
-        MemFree(ctx);
-        return NULL;
-    }
+/**
+ * A font given to InitNuklearEx(). Nuklear's font user data points to it, and uses it as a Font.
+ */
+typedef struct NuklearFont {
+    Font font;                     // The raylib font. This needs to be the first member.
+    NuklearGlyphAdvances advances; // The advances of the font's glyphs.
+    NuklearDynamicFont* dynamic;   // The glyph atlas of a dynamic font, or NULL when the font is baked.
+    bool sdf;                      // Whether the glyphs are signed distance fields, drawn with the SDF text shader.
+    struct NuklearFont* nextSDF;   // The next signed distance field font, to find them by texture.
+    int references;                // The amount of Nuklear fonts that use the font. The last one to be unloaded unloads it.
+    bool ownsFont;                 // Whether unloading the font unloads the raylib font too.
+    struct NuklearFont* nextShared; // The next font that LoadNuklearFont() shares, to find them by raylib font.
+} NuklearFont;
 
-    // Allocator
-    struct nk_allocator alloc;
-    alloc.userdata = nk_handle_ptr(0);
-    alloc.alloc = nk_raylib_malloc;
-    alloc.free = nk_raylib_mfree;
+/**
+ * A font file of the font registry, shared by all sizes of the font.
+ *
+ * @see GetNuklearFont()
+ */
+typedef struct NuklearFontFace {
+    char* fileName;          // The font file name, which the face is looked up by.
+    unsigned char* fileData; // The font file, kept to bake new sizes from.
+    int dataSize;            // The size of the font file.
+} NuklearFontFace;
 
-    // Initialize the context.
-    if (!nk_init(ctx, &alloc, userFont)) {
-        TraceLog(LOG_ERROR, "NUKLEAR: Failed to initialize nuklear");
-        MemFree(ctx);
-        MemFree(userData);
-        return NULL;
-    }
+/**
+ * A font of the font registry, at one logical size of a face.
+ *
+ * @see GetNuklearFont()
+ */
+typedef struct NuklearRegisteredFont {
+    int face;                      // The index of the font's face.
+    float size;                    // The logical size of the font, which Nuklear lays out text with.
+    float scale;                   // The scaling that the font's glyphs are baked at.
+    struct nk_user_font* userFont; // The Nuklear font, which keeps its address when the font is baked again.
+} NuklearRegisteredFont;
 
-    // Clipboard
-    ctx->clip.copy = nk_raylib_clipboard_copy;
-    ctx->clip.paste = nk_raylib_clipboard_paste;
-    ctx->clip.userdata = nk_handle_ptr(0);
+/**
+ * A line of wrapped text, from the line-break cache.
+ *
+ * @see nk_raylib_text_wrap()
+ */
+typedef struct NuklearWrapLine {
+    int length;  // The amount of bytes on the line.
+    float width; // The width of the line's text.
+} NuklearWrapLine;
 
-    // Set the internal user data.
-    userData->scaling = 1.0f;
-    userData->insert_mode = true;
-    userData->last_left_press = 0.0;
-    userData->double_clicking = false;
-    nk_handle userDataHandle;
-    userDataHandle.id = 1;
-    userDataHandle.ptr = (void*)userData;
-    nk_set_user_data(ctx, userDataHandle);
+/**
+ * Wrapped text whose line breaks are cached, so that unchanged text doesn't have to be measured again.
+ *
+ * @see nk_raylib_text_wrap()
+ */
+typedef struct NuklearWrapText {
+    unsigned long long hash;           // The hash of the text.
+    int length;                        // The length of the text, in bytes.
+    const struct nk_user_font* font;   // The font that the text was measured with.
+    float fontHeight;                  // The height of the font.
+    float width;                       // The width that the text was wrapped at.
+    float scale;                       // The scaling of the context.
+    unsigned int seq;                  // The Nuklear frame that the text was last laid out in, to age it out like windows.
+    NuklearWrapLine* lines;            // The lines of the text.
+    int lineCount;                     // The amount of lines.
+} NuklearWrapText;
 
-    TraceLog(LOG_INFO, "NUKLEAR: Initialized GUI");
+/**
+ * A glyph of a text run, placed relative to the text's position.
+ *
+ * @see raylib_nuklear_get_text_run()
+ */
+typedef struct NuklearGlyphQuad {
+    int index;      // The glyph index, whose source rectangle is looked up when drawing, as atlases may move it.
+    Rectangle dest; // Where the glyph is drawn, relative to the text's position.
+} NuklearGlyphQuad;
 
-    return ctx;
-}
+/**
+ * Text laid out into glyph quads, so that drawing it again doesn't decode it or look up its glyphs.
+ *
+ * @see raylib_nuklear_get_text_run()
+ */
+typedef struct NuklearTextRun {
+    unsigned long long hash; // The hash of the text, the font, the font size and the spacing.
+    const GlyphInfo* glyphs; // The glyphs of the font that the text was laid out with, telling fonts in one atlas apart.
+    int glyphCount;          // The amount of glyphs of that font, which its glyph indices are below.
+    unsigned int texture;    // The texture of the font that the text was laid out with.
+    float fontSize;          // The size that the text was laid out at.
+    float spacing;           // The spacing between the glyphs.
+    int length;              // The length of the text, in bytes.
+    NuklearGlyphQuad* quads; // The glyphs to draw, leaving out spaces and tabs.
+    int quadCount;           // The amount of glyphs.
+    unsigned int frame;      // The last frame the text was drawn in, to evict text that's gone.
+} NuklearTextRun;
 
 /**
- * Initialize the Nuklear context for use with Raylib.
+ * The text runs that were drawn recently, with a hash table to look them up.
  *
- * @param fontSize The size of the font to use for GUI text. Use 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ * @see raylib_nuklear_get_text_run()
+ */
+typedef struct NuklearTextRunCache {
+    NuklearTextRun* runs; // The cached text runs.
+    int count;            // The amount of text runs.
+    int capacity;         // The allocated capacity of runs.
+    int* slots;           // Open addressing hash table of indices into runs, plus one, with 0 for empty slots.
+    int slotCount;        // The amount of slots, a power of two. 0 when there are none.
+    unsigned int frame;   // The frame that's being drawn.
+} NuklearTextRunCache;
+
+/**
+ * A window that was rendered into a render texture, so it can be drawn again while its commands are unchanged.
  *
- * @return The nuklear context, or NULL on error.
+ * @see SetNuklearWindowCache()
  */
-NK_API struct nk_context*
-InitNuklear(int fontSize)
-{
-    // User font.
-    struct nk_user_font* userFont = (struct nk_user_font*)MemAlloc(sizeof(struct nk_user_font));
-    if (userFont == NULL) {
-        TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate nuklear font");
-        return NULL;
-    }
+typedef struct NuklearWindowCache {
+    nk_hash name;            // The name hash of the cached window.
+    unsigned long long hash; // Hash of the window's commands when it was rendered. 0 when it needs rendering.
+    RenderTexture2D target;  // The rendered window.
+    unsigned int frame;      // The last frame that the window was drawn in, to evict closed windows.
+} NuklearWindowCache;
 
-    // Use the default font size if desired.
-    if (fontSize <= 0) {
-        fontSize = RAYLIB_NUKLEAR_DEFAULT_FONTSIZE;
-    }
+/**
+ * A page of the texture atlas, filled by a shelf packer.
+ *
+ * @see SetNuklearAtlas()
+ */
+typedef struct NuklearAtlasPage {
+    Image image;       // The pixels of the page, kept to repack it.
+    Texture2D texture; // The page's texture.
+    int shelfX;        // Where the next image goes on the current shelf.
+    int shelfY;        // The top of the current shelf.
+    int shelfHeight;   // The height of the current shelf.
+    bool changed;      // Whether the image changed since it was uploaded to the texture.
+} NuklearAtlasPage;
 
-    userFont->height = (float)fontSize;
-    userFont->width = nk_raylib_font_get_text_width;
-    userFont->userdata = nk_handle_ptr(0);
+/**
+ * A texture registered with AddNuklearAtlasTexture().
+ *
+ * @see AddNuklearAtlasTexture()
+ */
+typedef struct NuklearAtlasImage {
+    unsigned int texture; // The id of the registered texture, which images refer to.
+    Image image;          // A copy of the texture's pixels, to pack it.
+    int page;             // The page that the image is packed into, or -1 when it isn't.
+    Rectangle region;     // Where the image is on its page.
+    unsigned int frame;   // The last frame the image was drawn in.
+    bool wanted;          // Whether the image is waiting to be packed.
+} NuklearAtlasImage;
 
-    // Nuklear context.
-    return InitNuklearContext(userFont);
-}
+/**
+ * Texture atlas pages shared by text, shapes and icons, so that drawing them doesn't switch textures.
+ *
+ * @see SetNuklearAtlas()
+ */
+typedef struct NuklearAtlas {
+    NuklearAtlasPage pages[RAYLIB_NUKLEAR_ATLAS_PAGES]; // The atlas pages.
+    int pageCount;                                       // The amount of pages in use.
+    Rectangle white;             // A white texel on the first page, for drawing shapes.
+    const void* source;          // The user font data of the font in the atlas, NULL for raylib's default font.
+    unsigned int sourceTexture;  // The texture of the font in the atlas, to notice when it changes.
+    Image fontImage;             // A copy of the source font's pixels.
+    Font font;                   // The source font, drawing from the atlas. Its texture id is 0 when it didn't fit.
+    Rectangle fontRegion;        // Where the font is in the atlas, which its recs are offset by.
+    NuklearAtlasImage* images;   // The registered textures.
+    int imageCount;              // The amount of registered textures.
+    int imageCapacity;           // The allocated capacity of images.
+    bool dirty;                  // Whether any registered texture is waiting to be packed.
+    unsigned int frame;          // The frame that's being drawn.
+    unsigned int repackFrame;    // The frame that the atlas was last repacked in.
+} NuklearAtlas;
 
 /**
- * Initialize the Nuklear context for use with Raylib, with a supplied custom font.
+ * Plans the capacity of Nuklear's command buffer from the demand of the recently drawn frames.
  *
- * @param font The custom raylib font to use with Nuklear.
- * @param fontSize The desired size of the font. Use 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ * @see ReserveNuklearCommandBuffer()
+ * @internal
+ */
+typedef struct NuklearCommandPlanner {
+    size_t demand[RAYLIB_NUKLEAR_COMMAND_HISTORY]; // The command buffer bytes that the recent frames needed, as a ring buffer.
+    int demandCount;           // The amount of frames in demand.
+    int demandIndex;           // Where the next frame's demand goes.
+    size_t target;             // The planned capacity.
+    size_t reserved;           // The capacity from ReserveNuklearCommandBuffer(), which the buffer doesn't shrink below.
+    unsigned int shrinkFrames; // The frames the buffer has to be oversized before it shrinks, or 0 to never shrink.
+    unsigned int quietFrames;  // The frames the buffer has been oversized for.
+} NuklearCommandPlanner;
+
+/**
+ * The amount of widget states in each page of a NuklearStateIndex.
  *
- * @return The nuklear context, or NULL on error.
+ * @internal
  */
-NK_API struct nk_context*
-InitNuklearEx(Font font, float fontSize)
-{
-    // Copy the font to a new raylib font pointer.
-    struct Font* newFont = (struct Font*)MemAlloc(sizeof(struct Font));
-    if (newFont == NULL) {
-        TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate font");
-        return NULL;
-    }
+#define RAYLIB_NUKLEAR_STATE_PAGE_SIZE 1024
 
-    // Use the default font size if desired.
+/**
+ * The persisted state of a tree or group, like Nuklear keeps in the value tables of its window.
+ *
+ * @see nk_raylib_tree_push_hashed()
+ * @internal
+ */
+typedef struct NuklearWidgetState {
+    nk_hash window;    // The name hash of the window that the widget is in.
+    nk_hash id;        // The hash of the widget, from raylib_nuklear_hash_id().
+    nk_uint values[2]; // The collapse state of a tree, or the horizontal and vertical scroll offsets of a group.
+} NuklearWidgetState;
+
+/**
+ * An open addressing hash index of widget states, which are dropped along with their window.
+ *
+ * The states are kept in pages that don't move as states are added, as Nuklear holds on to the scroll offsets of a
+ * group until the group ends.
+ *
+ * @internal
+ */
+typedef struct NuklearStateIndex {
+    NuklearWidgetState** pages; // The pages of RAYLIB_NUKLEAR_STATE_PAGE_SIZE states.
+    int pageCount;              // The amount of pages.
+    int count;                  // The amount of states.
+    int* slots;                 // The hash index, holding each state's index plus one, or 0 for empty slots.
+    int slotCount;              // The amount of slots, a power of two. 0 when there are none.
+    nk_hash* windows;           // The name hashes of the windows that have states.
+    int windowCount;            // The amount of windows that have states.
+    int windowCapacity;         // The allocated capacity of windows.
+} NuklearStateIndex;
+
+/**
+ * The amount of strings that a NuklearHashMemo remembers the hash of. Needs to be a power of two.
+ *
+ * @internal
+ */
+#define RAYLIB_NUKLEAR_HASH_MEMO_SIZE 256
+
+/**
+ * The shortest string that a NuklearHashMemo remembers, as shorter strings are hashed faster than they're compared.
+ *
+ * @internal
+ */
+#define RAYLIB_NUKLEAR_HASH_MEMO_MIN_LENGTH 128
+
+/**
+ * The most bytes of strings that a NuklearHashMemo copies each frame.
+ *
+ * @internal
+ */
+#define RAYLIB_NUKLEAR_HASH_MEMO_COPY_LIMIT (64 * 1024)
+
+/**
+ * A remembered string hash of a NuklearHashMemo.
+ *
+ * @internal
+ */
+typedef struct NuklearHashMemoEntry {
+    const char* str;         // The string that was hashed.
+    int len;                 // The length of the string.
+    unsigned int frame;      // The frame of the memo that the entry is from. Entries from earlier frames are unused.
+    size_t copy;             // Where the copy of the string is in the memo's copies, to make sure it's unchanged.
+    unsigned long long hash; // The hash of the string.
+} NuklearHashMemoEntry;
+
+/**
+ * Remembers the hashes of the long widget IDs that were hashed this frame, by their pointer and length.
+ *
+ * @see raylib_nuklear_hash_id()
+ * @internal
+ */
+typedef struct NuklearHashMemo {
+    NuklearHashMemoEntry* entries; // RAYLIB_NUKLEAR_HASH_MEMO_SIZE entries, or NULL until they're needed.
+    char* copies;                  // Copies of the hashed strings, to tell when a string changed at the same address.
+    size_t copySize;               // The bytes of copies in use this frame.
+    size_t copyCapacity;           // The allocated size of copies.
+    unsigned int frame;            // The current frame, which starts at 1.
+    unsigned int hits;             // The hashes that were found in the memo.
+    unsigned int misses;           // The hashes that were computed and added to the memo.
+} NuklearHashMemo;
+
+typedef struct NuklearMemoryTracker NuklearMemoryTracker;
+
+/**
+ * The buffer that an nk_allocator of a context allocates for, passed to its callbacks as their handle.
+ *
+ * @internal
+ */
+typedef struct NuklearAllocationSource {
+    NuklearMemoryTracker* tracker; // The tracker of the context.
+    NuklearMemorySource source;    // The buffer that's allocated for.
+} NuklearAllocationSource;
+
+/**
+ * Counts the memory that a context allocates through its NuklearAllocator.
+ *
+ * @internal
+ */
+struct NuklearMemoryTracker {
+    NuklearAllocator allocator;                                 // The allocator that the memory comes from.
+    NuklearAllocationSource sources[NUKLEAR_MEMORY_SOURCE_COUNT]; // The handles of each buffer's nk_allocator.
+    size_t live;                                                // The bytes that are allocated.
+    size_t peak;                                                // The most bytes that were allocated at once.
+    size_t sourceBytes[NUKLEAR_MEMORY_SOURCE_COUNT];            // The bytes that are allocated by each buffer.
+    unsigned int sourceAllocations[NUKLEAR_MEMORY_SOURCE_COUNT]; // The blocks that each buffer allocated.
+    unsigned int allocations;                                   // The blocks that were allocated.
+    unsigned int reallocations;                                 // The times a buffer grew or shrank.
+    unsigned int inPlaceReallocations;                          // The reallocations that were done in place.
+    unsigned int frameStart;                                    // The allocations at the start of the frame.
+    unsigned int frameAllocations;                              // The blocks that were allocated during the last frame.
+};
+
+/**
+ * The user data that's leverages internally through Nuklear.
+ */
+typedef struct NuklearUserData {
+    float scaling;           // The scaling of the Nuklear user interface.
+    bool insert_mode;        // Whether keyboard insert mode is active.
+    double last_left_press;  // Time of the last left-button press, for double-click detection.
+    bool double_clicking; // Whether a double-click is currently in progress.
+    bool input_active;       // Whether the last UpdateNuklear() call saw any input activity.
+    int redraw_frames;       // The amount of updates left that ShouldNuklearRedraw() requests a redraw for.
+    bool frame_tracking;               // Whether the drawn frames are hashed, to detect unchanged frames.
+    unsigned long long frame_hash;     // Hash of the last drawn frame.
+    bool frame_hashed;                 // Whether frame_seq_hash holds the hash of the frame with sequence number frame_seq.
+    bool frame_hashable;               // Whether that frame could be hashed, which frames with custom commands can't.
+    nk_uint frame_seq;                 // The sequence number of the frame that was last hashed.
+    unsigned long long frame_seq_hash; // The hash of that frame, so it isn't hashed again before it's drawn.
+    void* polygon_scratch;       // Scratch memory for triangulating filled polygons, reused across frames.
+    size_t polygon_scratch_size; // The size of polygon_scratch, in bytes.
+    bool window_cache_enabled;           // Whether windows are cached in render textures.
+    NuklearWindowCache* window_cache;    // The cached windows.
+    int window_cache_count;              // The amount of cached windows.
+    int window_cache_capacity;           // The allocated capacity of window_cache.
+    unsigned int frame;                  // The amount of frames that have been drawn.
+    NuklearRenderStats stats;            // Rendering statistics from the last frame.
+    Shader sdf_shader;                   // The signed distance field shader for shapes. Its id is 0 when disabled.
+    NuklearAtlas* atlas;                 // The texture atlas, or NULL when disabled.
+    NuklearFontFace* font_faces;         // The font files of the font registry.
+    int font_face_count;                 // The amount of font files.
+    NuklearRegisteredFont* fonts;        // The fonts of the font registry.
+    int font_count;                      // The amount of registered fonts.
+    int font_capacity;                   // The allocated capacity of fonts. font_faces grows along with it.
+    NuklearWrapText* wrap_texts;         // The line-break cache of wrapped text.
+    int wrap_text_count;                 // The amount of cached wrapped texts.
+    int wrap_text_capacity;              // The allocated capacity of wrap_texts.
+    int* wrap_slots;                     // Open addressing hash table of indices into wrap_texts, plus one, with 0 for empty slots.
+    int wrap_slot_count;                 // The amount of wrap_slots, a power of two. 0 when there are none.
+    unsigned int wrap_seq;               // The Nuklear frame that the line-break cache was last aged in.
+    NuklearTextRunCache text_runs;       // The glyph layouts of recently drawn text.
+    void* arena;                         // The memory given to InitNuklearFixed(), or NULL when the context allocates its memory.
+    size_t arena_size;                   // The size of the arena.
+    size_t arena_header;                 // The bytes at the start of the arena that hold the context, user data and font.
+    size_t arena_peak;                   // The most bytes of the arena that were in use at once.
+    bool arena_overflow;                 // Whether the arena ran out of memory.
+    NuklearMemoryTracker memory;         // The allocator of the context, and how much it allocated.
+    NuklearCommandPlanner commands_plan; // The planned capacity of Nuklear's command buffer.
+    NuklearStateIndex states;            // The states of trees and groups from nk_raylib_tree_push() and nk_raylib_group_begin().
+    NuklearHashMemo hash_memo;           // The hashes of this frame's long widget IDs.
+#ifdef RAYLIB_NUKLEAR_USE_VERTEX_BUFFER
+    struct nk_buffer commands; // Draw commands from nk_convert(), kept between frames to avoid reallocating.
+    struct nk_buffer vertices; // Vertex data from nk_convert(), kept between frames to avoid reallocating.
+    struct nk_buffer elements; // Index data from nk_convert(), kept between frames to avoid reallocating.
+#endif
+} NuklearUserData;
+
+/**
+ * The state that's tracked while drawing Nuklear commands with DrawNuklear().
+ *
+ * @see raylib_nuklear_draw_command()
+ */
+typedef struct NuklearDrawState {
+    float scale;               // The scaling of the Nuklear context.
+    Vector2 origin;            // The screen position that's drawn at (0, 0). Geometry is expected to be translated by the caller, this only offsets the scissor.
+    Rectangle view;            // The drawable area, used to cull commands that are off screen.
+    Rectangle clip;            // The active clip rectangle, intersected with the view.
+    bool scissor;              // Whether a scissor is active.
+    int scissorRect[4];        // The active scissor, as given to BeginScissorMode().
+    NuklearRenderStats* stats; // Where to count the drawn, culled and skipped commands.
+    const Shader* sdfShader;   // The signed distance field shader for shapes, or NULL to tessellate them.
+    NuklearAtlas* atlas;       // The texture atlas, or NULL when disabled.
+    unsigned int shapesTexture; // The texture that shapes are drawn with.
+    unsigned int texture;      // The texture the previous command was drawn with, or 0 when unknown.
+    bool sdfText;              // Whether the signed distance field text shader is active.
+    NuklearTextRunCache* textRuns; // The cache of laid out text, or NULL to draw text with DrawTextEx().
+} NuklearDrawState;
+
+#ifdef RAYLIB_NUKLEAR_USE_VERTEX_BUFFER
+/**
+ * The vertex layout that nk_convert() writes for DrawNuklearBatched().
+ *
+ * @see DrawNuklearBatched()
+ */
+typedef struct NuklearVertex {
+    float position[2];
+    float uv[2];
+    nk_byte col[4];
+} NuklearVertex;
+#endif
+
+/**
+ * Get the advance of the given glyph, the way MeasureTextEx() does.
+ *
+ * @internal
+ */
+static float
+raylib_nuklear_glyph_advance(const Font* font, int index)
+{
+    if (font->glyphs[index].advanceX > 0) {
+        return (float)font->glyphs[index].advanceX;
+    }
+    return font->recs[index].width + (float)font->glyphs[index].offsetX;
+}
+
+/**
+ * Get the hash map slot of the given codepoint.
+ *
+ * @internal
+ */
+static int
+raylib_nuklear_glyph_advances_slot(const NuklearGlyphAdvances* advances, int codepoint)
+{
+    unsigned int mask = (unsigned int)advances->mapSize - 1;
+    unsigned int slot = ((unsigned int)codepoint * 2654435761u) & mask;
+    while (advances->codepoints[slot] != 0 && advances->codepoints[slot] != codepoint) {
+        slot = (slot + 1) & mask;
+    }
+    return (int)slot;
+}
+
+/**
+ * Unload the hash map of the given advance table.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_unload_glyph_advances(NuklearGlyphAdvances* advances)
+{
+    MemFree(advances->codepoints);
+    MemFree(advances->advances);
+    MemFree(advances->indices);
+    advances->codepoints = NULL;
+    advances->advances = NULL;
+    advances->indices = NULL;
+    advances->mapSize = 0;
+    advances->mapCount = 0;
+}
+
+/**
+ * Build the advance table of the given font.
+ *
+ * @param advances The table to fill in. Unload it with raylib_nuklear_unload_glyph_advances().
+ * @param font The font.
+ * @param map Whether to build a hash map of the codepoints from 256 up. Without it, they're searched for.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_load_glyph_advances(NuklearGlyphAdvances* advances, const Font* font, bool map)
+{
+    nk_memset(advances, 0, sizeof(NuklearGlyphAdvances));
+    advances->texture = font->texture.id;
+    if (font->glyphs == NULL || font->recs == NULL || font->glyphCount <= 0) {
+        return;
+    }
+
+    // Codepoints that the font doesn't have fall back to '?', or the first glyph, like GetGlyphIndex().
+    advances->fallbackIndex = GetGlyphIndex(*font, -1);
+    advances->fallback = raylib_nuklear_glyph_advance(font, advances->fallbackIndex);
+    for (int i = 0; i < 256; i++) {
+        advances->latin1[i] = advances->fallback;
+        advances->latin1Index[i] = advances->fallbackIndex;
+    }
+
+    // Go backwards, so that the first of any duplicate codepoints wins, like GetGlyphIndex().
+    int wide = 0;
+    advances->monospace = raylib_nuklear_glyph_advance(font, 0);
+    for (int i = font->glyphCount - 1; i >= 0; i--) {
+        float advance = raylib_nuklear_glyph_advance(font, i);
+        if (advance != advances->monospace) {
+            advances->monospace = 0.0f;
+        }
+        if (font->glyphs[i].value >= 0 && font->glyphs[i].value < 256) {
+            advances->latin1[font->glyphs[i].value] = advance;
+            advances->latin1Index[font->glyphs[i].value] = i;
+        }
+        else if (font->glyphs[i].value >= 256) {
+            wide++;
+        }
+    }
+    if (wide == 0) {
+        return;
+    }
+
+    // Keep the hash map at most half full.
+    int size = 16;
+    while (size < wide * 2) {
+        size *= 2;
+    }
+    if (map) {
+        advances->codepoints = (int*)MemAlloc((unsigned int)((size_t)size * sizeof(int)));
+        advances->advances = (float*)MemAlloc((unsigned int)((size_t)size * sizeof(float)));
+        advances->indices = (int*)MemAlloc((unsigned int)((size_t)size * sizeof(int)));
+    }
+    if (advances->codepoints == NULL || advances->advances == NULL || advances->indices == NULL) {
+        raylib_nuklear_unload_glyph_advances(advances);
+        advances->search = true;
+        return;
+    }
+
+    nk_memset(advances->codepoints, 0, (nk_size)size * sizeof(int));
+    advances->mapSize = size;
+    advances->mapCount = wide;
+    for (int i = font->glyphCount - 1; i >= 0; i--) {
+        if (font->glyphs[i].value >= 256) {
+            int slot = raylib_nuklear_glyph_advances_slot(advances, font->glyphs[i].value);
+            advances->codepoints[slot] = font->glyphs[i].value;
+            advances->advances[slot] = raylib_nuklear_glyph_advance(font, i);
+            advances->indices[slot] = i;
+        }
+    }
+}
+
+/**
+ * Add a glyph to the advance table, growing its hash map as needed.
+ *
+ * @return False when the hash map couldn't grow.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_glyph_advances_insert(NuklearGlyphAdvances* advances, int codepoint, int index, float advance)
+{
+    if (codepoint >= 0 && codepoint < 256) {
+        advances->latin1[codepoint] = advance;
+        advances->latin1Index[codepoint] = index;
+        return true;
+    }
+    if (codepoint < 256) {
+        return false;
+    }
+
+    // Keep the hash map at most half full.
+    if ((advances->mapCount + 1) * 2 > advances->mapSize) {
+        NuklearGlyphAdvances grown = *advances;
+        grown.mapSize = (advances->mapSize == 0) ? 16 : advances->mapSize * 2;
+        grown.mapCount = 0;
+        grown.codepoints = (int*)MemAlloc((unsigned int)((size_t)grown.mapSize * sizeof(int)));
+        grown.advances = (float*)MemAlloc((unsigned int)((size_t)grown.mapSize * sizeof(float)));
+        grown.indices = (int*)MemAlloc((unsigned int)((size_t)grown.mapSize * sizeof(int)));
+        if (grown.codepoints == NULL || grown.advances == NULL || grown.indices == NULL) {
+            raylib_nuklear_unload_glyph_advances(&grown);
+            return false;
+        }
+        nk_memset(grown.codepoints, 0, (nk_size)grown.mapSize * sizeof(int));
+        for (int i = 0; i < advances->mapSize; i++) {
+            if (advances->codepoints[i] != 0) {
+                int slot = raylib_nuklear_glyph_advances_slot(&grown, advances->codepoints[i]);
+                grown.codepoints[slot] = advances->codepoints[i];
+                grown.advances[slot] = advances->advances[i];
+                grown.indices[slot] = advances->indices[i];
+                grown.mapCount++;
+            }
+        }
+        raylib_nuklear_unload_glyph_advances(advances);
+        *advances = grown;
+    }
+
+    int slot = raylib_nuklear_glyph_advances_slot(advances, codepoint);
+    if (advances->codepoints[slot] == 0) {
+        advances->codepoints[slot] = codepoint;
+        advances->mapCount++;
+    }
+    advances->advances[slot] = advance;
+    advances->indices[slot] = index;
+    return true;
+}
+
+/**
+ * Decode the codepoint at the given position of the first len bytes of the text, and move past it.
+ *
+ * Invalid and cut off sequences are '?', like GetCodepointNext().
+ *
+ * @internal
+ */
+static int
+raylib_nuklear_next_codepoint(const char* text, int len, int* position)
+{
+    int codepoint = (unsigned char)text[*position];
+    int size = 1;
+    if (codepoint >= 0x80) {
+        codepoint = GetCodepointNext(text + *position, &size);
+        if (size <= 0 || *position + size > len) {
+            codepoint = '?';
+            size = 1;
+        }
+    }
+    *position += size;
+    return codepoint;
+}
+
+/**
+ * Get the index of the glyph that raylib draws the given codepoint with, like GetGlyphIndex() without searching.
+ *
+ * @internal
+ */
+static int
+raylib_nuklear_glyph_index(const Font* font, const NuklearGlyphAdvances* advances, int codepoint)
+{
+    if (codepoint >= 0 && codepoint < 256) {
+        return advances->latin1Index[codepoint];
+    }
+    else if (advances->mapSize > 0) {
+        int slot = raylib_nuklear_glyph_advances_slot(advances, codepoint);
+        return (advances->codepoints[slot] != 0) ? advances->indices[slot] : advances->fallbackIndex;
+    }
+    else if (advances->search) {
+        return GetGlyphIndex(*font, codepoint);
+    }
+    return advances->fallbackIndex;
+}
+
+/**
+ * Measure the width of the first len bytes of the given text, matching MeasureTextEx() without copying the text or
+ * searching the font's glyphs.
+ *
+ * Nuklear expects one spacing for every character, while MeasureTextEx() only counts the spacing between them, so
+ * this includes one more spacing.
+ *
+ * @internal
+ */
+static float
+raylib_nuklear_measure_text(const Font* font, const NuklearGlyphAdvances* advances, const char* text, int len, float fontSize, float spacing)
+{
+    if (font->baseSize <= 0) {
+        return 0.0f;
+    }
+
+    float width = 0.0f;
+    float widest = 0.0f;
+    int count = 0;
+    int most = 0;
+    bool monospace = advances->monospace > 0.0f;
+    for (int i = 0; i < len;) {
+        int codepoint = raylib_nuklear_next_codepoint(text, len, &i);
+        if (codepoint == '\n') {
+            widest = NK_MAX(widest, width);
+            width = 0.0f;
+            count = 0;
+            continue;
+        }
+        count++;
+        most = NK_MAX(most, count);
+
+        if (monospace) {
+            continue;
+        }
+        else if (codepoint < 256) {
+            width += advances->latin1[codepoint];
+        }
+        else if (advances->mapSize > 0) {
+            int slot = raylib_nuklear_glyph_advances_slot(advances, codepoint);
+            width += (advances->codepoints[slot] != 0) ? advances->advances[slot] : advances->fallback;
+        }
+        else if (advances->search) {
+            width += raylib_nuklear_glyph_advance(font, GetGlyphIndex(*font, codepoint));
+        }
+        else {
+            width += advances->fallback;
+        }
+    }
+    widest = monospace ? (float)most * advances->monospace : NK_MAX(widest, width);
+
+    return widest * fontSize / (float)font->baseSize + (float)most * spacing;
+}
+
+/**
+ * The advance table of raylib's default font, built when it's first measured.
+ *
+ * @internal
+ */
+static NuklearGlyphAdvances raylib_nuklear_default_font_advances = {0};
+
+/**
+ * Get the advance table of raylib's default font, building it when the font changed.
+ *
+ * @internal
+ */
+static const NuklearGlyphAdvances*
+raylib_nuklear_get_default_font_advances(const Font* font)
+{
+    // The default font only has codepoints below 256, so it goes without a hash map that would need freeing.
+    if (raylib_nuklear_default_font_advances.texture != font->texture.id) {
+        raylib_nuklear_load_glyph_advances(&raylib_nuklear_default_font_advances, font, false);
+    }
+    return &raylib_nuklear_default_font_advances;
+}
+
+/**
+ * The dynamic fonts that are loaded, to upload their glyph atlases once per frame.
+ *
+ * @internal
+ */
+static NuklearDynamicFont* raylib_nuklear_dynamic_fonts = NULL;
+
+/**
+ * The frame that dynamic fonts are used in, to evict their least recently used pages.
+ *
+ * @internal
+ */
+static unsigned int raylib_nuklear_dynamic_font_frame = 1;
+
+/**
+ * The signed distance field fonts that are loaded, which share the SDF text shader.
+ *
+ * @internal
+ */
+static NuklearFont* raylib_nuklear_sdf_fonts = NULL;
+
+/**
+ * The fonts that LoadNuklearFont() built from raylib fonts, which are shared by everything that loads the same font.
+ *
+ * @internal
+ */
+static NuklearFont* raylib_nuklear_shared_fonts = NULL;
+
+/**
+ * The shader that draws the text of signed distance field fonts, loaded when they're first drawn. Its id is 0 when it
+ * isn't loaded, or shaders are unavailable.
+ *
+ * @internal
+ */
+static Shader raylib_nuklear_sdf_text_shader = {0};
+
+/**
+ * Whether loading the SDF text shader was attempted, so that it isn't attempted again when shaders are unavailable.
+ *
+ * @internal
+ */
+static bool raylib_nuklear_sdf_text_shader_loaded = false;
+
+/**
+ * Evict the least recently used page of a dynamic font's glyph atlas, that isn't used in the current frame.
+ *
+ * @return The evicted page, or -1 when every page is in use.
+ *
+ * @internal
+ */
+static int
+raylib_nuklear_dynamic_font_evict(NuklearFont* font)
+{
+    NuklearDynamicFont* dynamic = font->dynamic;
+    int oldest = -1;
+    for (int i = 0; i < RAYLIB_NUKLEAR_DYNAMIC_FONT_PAGES; i++) {
+        unsigned int age = raylib_nuklear_dynamic_font_frame - dynamic->pages[i].frame;
+        if (age > 0 && (oldest < 0 || age > raylib_nuklear_dynamic_font_frame - dynamic->pages[oldest].frame)) {
+            oldest = i;
+        }
+    }
+    if (oldest < 0) {
+        return -1;
+    }
+
+    const int pageHeight = dynamic->image.height / RAYLIB_NUKLEAR_DYNAMIC_FONT_PAGES;
+    const int top = oldest * pageHeight;
+    nk_memset((unsigned char*)dynamic->image.data + (size_t)top * (size_t)dynamic->image.width * 2, 0, (nk_size)pageHeight * (nk_size)dynamic->image.width * 2);
+    dynamic->dirtyTop = (dynamic->dirtyTop < dynamic->dirtyBottom) ? NK_MIN(dynamic->dirtyTop, top) : top;
+    dynamic->dirtyBottom = NK_MAX(dynamic->dirtyBottom, top + pageHeight);
+    dynamic->pages[oldest] = CLITERAL(NuklearDynamicFontPage) {0};
+    for (int i = 0; i < font->font.glyphCount; i++) {
+        if (dynamic->glyphPages[i] == oldest) {
+            dynamic->glyphPages[i] = -1;
+        }
+    }
+    return oldest;
+}
+
+/**
+ * Pack a rasterized glyph into a dynamic font's glyph atlas, leaving a pixel of padding around it.
+ *
+ * Glyphs without an image or too large for a page are marked as never fitting, and a glyph that doesn't fit while
+ * every page is in use marks the atlas as full for the frame, so that neither is rasterized again on each measurement.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_dynamic_font_pack(NuklearFont* font, int index, Image image)
+{
+    NuklearDynamicFont* dynamic = font->dynamic;
+    const int pageHeight = dynamic->image.height / RAYLIB_NUKLEAR_DYNAMIC_FONT_PAGES;
+    const int width = image.width + 2;
+    const int height = image.height + 2;
+    if (image.data == NULL || image.format != PIXELFORMAT_UNCOMPRESSED_GRAYSCALE || width > dynamic->image.width || height > pageHeight) {
+        dynamic->glyphPages[index] = -2;
+        return;
+    }
+
+    // Find room on a page, or make room by evicting one.
+    int page = -1;
+    int x = 0;
+    int y = 0;
+    for (int i = 0; i < RAYLIB_NUKLEAR_DYNAMIC_FONT_PAGES && page < 0; i++) {
+        NuklearDynamicFontPage* current = &dynamic->pages[i];
+        x = current->shelfX;
+        y = current->shelfY;
+        if (x + width > dynamic->image.width) {
+            x = 0;
+            y += current->shelfHeight;
+        }
+        if (y + height <= pageHeight) {
+            page = i;
+        }
+    }
+    if (page < 0) {
+        page = raylib_nuklear_dynamic_font_evict(font);
+        if (page < 0) {
+            dynamic->fullFrame = raylib_nuklear_dynamic_font_frame;
+            return;
+        }
+        x = y = 0;
+    }
+
+    NuklearDynamicFontPage* current = &dynamic->pages[page];
+    if (y != current->shelfY) {
+        current->shelfHeight = 0;
+    }
+    current->shelfX = x + width;
+    current->shelfY = y;
+    current->shelfHeight = NK_MAX(current->shelfHeight, height);
+    current->frame = raylib_nuklear_dynamic_font_frame;
+
+    // Copy the coverage into the alpha of white gray and alpha pixels.
+    const int top = page * pageHeight + y + 1;
+    unsigned char* pixels = (unsigned char*)dynamic->image.data;
+    const unsigned char* coverage = (const unsigned char*)image.data;
+    for (int row = 0; row < image.height; row++) {
+        unsigned char* pixel = pixels + ((size_t)(top + row) * (size_t)dynamic->image.width + (size_t)x + 1) * 2;
+        for (int column = 0; column < image.width; column++) {
+            pixel[column * 2] = 255;
+            pixel[column * 2 + 1] = coverage[row * image.width + column];
+        }
+    }
+    dynamic->dirtyTop = (dynamic->dirtyTop < dynamic->dirtyBottom) ? NK_MIN(dynamic->dirtyTop, top) : top;
+    dynamic->dirtyBottom = NK_MAX(dynamic->dirtyBottom, top + image.height);
+
+    font->font.recs[index] = CLITERAL(Rectangle) {(float)(x + 1), (float)top, (float)image.width, (float)image.height};
+    dynamic->glyphPages[index] = page;
+}
+
+/**
+ * Rasterize the given codepoints of a dynamic font, adding them to the font and packing them into its atlas.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_dynamic_font_load_glyphs(NuklearFont* font, int* codepoints, int count)
+{
+    NuklearDynamicFont* dynamic = font->dynamic;
+#if RAYLIB_VERSION_MAJOR >= 6
+    int glyphCount = 0;
+    GlyphInfo* glyphs = LoadFontData(dynamic->fileData, dynamic->dataSize, font->font.baseSize, codepoints, count, FONT_DEFAULT, &glyphCount);
+#else
+    int glyphCount = count;
+    GlyphInfo* glyphs = LoadFontData(dynamic->fileData, dynamic->dataSize, font->font.baseSize, codepoints, count, FONT_DEFAULT);
+#endif
+    if (glyphs == NULL) {
+        TraceLog(LOG_WARNING, "NUKLEAR: Failed to rasterize %i glyphs", count);
+        return;
+    }
+
+    for (int i = 0; i < glyphCount; i++) {
+        int index = raylib_nuklear_glyph_index(&font->font, &font->advances, glyphs[i].value);
+        if (index >= font->font.glyphCount || font->font.glyphs[index].value != glyphs[i].value) {
+            if (font->font.glyphCount == dynamic->glyphCapacity) {
+                int capacity = (dynamic->glyphCapacity == 0) ? 128 : dynamic->glyphCapacity * 2;
+                GlyphInfo* grownGlyphs = (GlyphInfo*)MemRealloc(font->font.glyphs, (unsigned int)((size_t)capacity * sizeof(GlyphInfo)));
+                if (grownGlyphs != NULL) font->font.glyphs = grownGlyphs;
+                Rectangle* grownRecs = (Rectangle*)MemRealloc(font->font.recs, (unsigned int)((size_t)capacity * sizeof(Rectangle)));
+                if (grownRecs != NULL) font->font.recs = grownRecs;
+                int* grownPages = (int*)MemRealloc(dynamic->glyphPages, (unsigned int)((size_t)capacity * sizeof(int)));
+                if (grownPages != NULL) dynamic->glyphPages = grownPages;
+                if (grownGlyphs == NULL || grownRecs == NULL || grownPages == NULL) {
+                    break;
+                }
+                dynamic->glyphCapacity = capacity;
+            }
+
+            index = font->font.glyphCount;
+            if (!raylib_nuklear_glyph_advances_insert(&font->advances, glyphs[i].value, index, (glyphs[i].advanceX > 0) ? (float)glyphs[i].advanceX : (float)(glyphs[i].image.width + glyphs[i].offsetX))) {
+                break;
+            }
+            font->font.glyphs[index] = glyphs[i];
+            font->font.glyphs[index].image = CLITERAL(Image) {0};
+            font->font.recs[index] = CLITERAL(Rectangle) {0};
+            dynamic->glyphPages[index] = -1;
+            font->font.glyphCount++;
+        }
+        if (dynamic->glyphPages[index] == -1) {
+            raylib_nuklear_dynamic_font_pack(font, index, glyphs[i].image);
+        }
+    }
+
+    UnloadFontData(glyphs, glyphCount);
+}
+
+/**
+ * Make sure that the glyphs of the given text are in a dynamic font's atlas, rasterizing the ones that aren't, and
+ * mark their pages as used in this frame.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_dynamic_font_require(NuklearFont* font, const char* text, int len)
+{
+    NuklearDynamicFont* dynamic = font->dynamic;
+    int missing[64];
+    int missingCount = 0;
+    for (int i = 0; i < len;) {
+        int codepoint = raylib_nuklear_next_codepoint(text, len, &i);
+        if (codepoint == '\n') {
+            continue;
+        }
+
+        int index = raylib_nuklear_glyph_index(&font->font, &font->advances, codepoint);
+        if (index < font->font.glyphCount && font->font.glyphs[index].value == codepoint) {
+            int page = dynamic->glyphPages[index];
+            if (page >= 0) {
+                dynamic->pages[page].frame = raylib_nuklear_dynamic_font_frame;
+                continue;
+            }
+
+            // Glyphs that can never be packed aren't rasterized again, and the ones that didn't fit wait for the next frame.
+            if (page == -2 || dynamic->fullFrame == raylib_nuklear_dynamic_font_frame) {
+                continue;
+            }
+        }
+
+        // Rasterize the missing glyphs in batches.
+        bool listed = false;
+        for (int j = 0; j < missingCount && !listed; j++) {
+            listed = missing[j] == codepoint;
+        }
+        if (!listed) {
+            missing[missingCount++] = codepoint;
+        }
+        if (missingCount == (int)(sizeof(missing) / sizeof(missing[0]))) {
+            raylib_nuklear_dynamic_font_load_glyphs(font, missing, missingCount);
+            missingCount = 0;
+        }
+    }
+    if (missingCount > 0) {
+        raylib_nuklear_dynamic_font_load_glyphs(font, missing, missingCount);
+    }
+}
+
+/**
+ * Upload the rows of a dynamic font's glyph atlas that changed.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_dynamic_font_upload(NuklearDynamicFont* dynamic)
+{
+    if (dynamic->dirtyTop < dynamic->dirtyBottom) {
+        Rectangle rows = {0.0f, (float)dynamic->dirtyTop, (float)dynamic->image.width, (float)(dynamic->dirtyBottom - dynamic->dirtyTop)};
+        UpdateTextureRec(dynamic->texture, rows, (unsigned char*)dynamic->image.data + (size_t)dynamic->dirtyTop * (size_t)dynamic->image.width * 2);
+        dynamic->dirtyTop = dynamic->dirtyBottom = 0;
+    }
+}
+
+/**
+ * Upload the glyph atlases of all dynamic fonts that changed, and move on to the next frame.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_update_dynamic_fonts(void)
+{
+    for (NuklearDynamicFont* dynamic = raylib_nuklear_dynamic_fonts; dynamic != NULL; dynamic = dynamic->next) {
+        raylib_nuklear_dynamic_font_upload(dynamic);
+    }
+    raylib_nuklear_dynamic_font_frame++;
+}
+
+/**
+ * Nuklear callback; Get the width of the given text.
+ *
+ * @internal
+ */
+NK_API float
+nk_raylib_font_get_text_width(nk_handle handle, float height, const char *text, int len)
+{
+    NK_UNUSED(handle);
+
+    if (len > 0) {
+        Font font = GetFontDefault();
+        if (font.texture.id == 0) return 0;
+
+        // Match raylib's MeasureText() internal spacing behavior, without its int truncation that accumulates
+        // errors when measuring character by character.
+        int defaultFontSize = 10;
+        int fontSize = (int)height;
+        if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+        float spacing = (float)(fontSize / defaultFontSize);
+
+        return raylib_nuklear_measure_text(&font, raylib_nuklear_get_default_font_advances(&font), text, len, (float)fontSize, spacing);
+    }
+
+    return 0;
+}
+
+/**
+ * Nuklear callback; Get the width of the given text (userFont version)
+ *
+ * @internal
+ */
+NK_API float
+nk_raylib_font_get_text_width_user_font(nk_handle handle, float height, const char *text, int len)
+{
+    if (len > 0) {
+        // Spacing is determined by the font size multiplied by RAYLIB_NUKLEAR_FONT_SPACING_RATIO.
+        NuklearFont* font = (NuklearFont*)handle.ptr;
+        if (font->dynamic != NULL) {
+            raylib_nuklear_dynamic_font_require(font, text, len);
+        }
+        return raylib_nuklear_measure_text(&font->font, &font->advances, text, len, height, height * RAYLIB_NUKLEAR_FONT_SPACING_RATIO);
+    }
+
+    return 0;
+}
+
+#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+/**
+ * Fill in the Nuklear glyph information for the given codepoint, matching how DrawTextEx() places glyphs.
+ *
+ * @internal
+ */
+static void
+nk_raylib_font_query_glyph(const Font* font, const NuklearGlyphAdvances* advances, float fontSize, float spacing, struct nk_user_font_glyph *glyph, nk_rune codepoint)
+{
+    int index = raylib_nuklear_glyph_index(font, advances, (int)codepoint);
+    float scaleFactor = fontSize / (float)font->baseSize;
+    float padding = (float)font->glyphPadding;
+    Rectangle rec = font->recs[index];
+    GlyphInfo info = font->glyphs[index];
+
+    glyph->width = (rec.width + 2.0f * padding) * scaleFactor;
+    glyph->height = (rec.height + 2.0f * padding) * scaleFactor;
+    glyph->offset.x = ((float)info.offsetX - padding) * scaleFactor;
+    glyph->offset.y = ((float)info.offsetY - padding) * scaleFactor;
+    glyph->xadvance = ((info.advanceX == 0) ? rec.width : (float)info.advanceX) * scaleFactor + spacing;
+
+    // Spaces and tabs are never drawn by DrawTextEx(), so give them an empty quad.
+    if (codepoint == ' ' || codepoint == '\t') {
+        glyph->width = glyph->height = 0.0f;
+    }
+
+    glyph->uv[0].x = (rec.x - padding) / (float)font->texture.width;
+    glyph->uv[0].y = (rec.y - padding) / (float)font->texture.height;
+    glyph->uv[1].x = (rec.x + rec.width + padding) / (float)font->texture.width;
+    glyph->uv[1].y = (rec.y + rec.height + padding) / (float)font->texture.height;
+}
+
+/**
+ * Nuklear callback; Get the glyph information to render the given codepoint with nk_convert().
+ *
+ * @internal
+ */
+NK_API void
+nk_raylib_font_query_font_glyph(nk_handle handle, float height, struct nk_user_font_glyph *glyph, nk_rune codepoint, nk_rune next_codepoint)
+{
+    NK_UNUSED(handle);
+    NK_UNUSED(next_codepoint);
+
+    // Match DrawText()'s spacing for the default font.
+    int defaultFontSize = 10;
+    int fontSize = (int)height;
+    if (fontSize < defaultFontSize) fontSize = defaultFontSize;
+    Font font = GetFontDefault();
+    nk_raylib_font_query_glyph(&font, raylib_nuklear_get_default_font_advances(&font), (float)fontSize, (float)(fontSize / defaultFontSize), glyph, codepoint);
+}
+
+/**
+ * Nuklear callback; Get the glyph information to render the given codepoint with nk_convert() (userFont version)
+ *
+ * @internal
+ */
+NK_API void
+nk_raylib_font_query_font_glyph_user_font(nk_handle handle, float height, struct nk_user_font_glyph *glyph, nk_rune codepoint, nk_rune next_codepoint)
+{
+    NK_UNUSED(next_codepoint);
+    NuklearFont* font = (NuklearFont*)handle.ptr;
+    if (font->dynamic != NULL) {
+        char text[4];
+        int len = (int)nk_utf_encode(codepoint, text, 4);
+        raylib_nuklear_dynamic_font_require(font, text, len);
+    }
+    nk_raylib_font_query_glyph(&font->font, &font->advances, height, height * RAYLIB_NUKLEAR_FONT_SPACING_RATIO, glyph, codepoint);
+}
+#endif  // NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+
+/**
+ * Nuklear callback; Paste the current clipboard.
+ *
+ * @internal
+ */
+NK_API void
+nk_raylib_clipboard_paste(nk_handle usr, struct nk_text_edit *edit)
+{
+    const char *text = GetClipboardText();
+    NK_UNUSED(usr);
+    if (text != NULL) {
+        nk_textedit_paste(edit, text, (int)TextLength(text));
+    }
+}
+
+/**
+ * Nuklear callback; Copy the given text.
+ *
+ * @internal
+ */
+NK_API void
+nk_raylib_clipboard_copy(nk_handle usr, const char *text, int len)
+{
+    NK_UNUSED(usr);
+    char* trimmedText = (char*)MemAlloc((unsigned int)(sizeof(char) * (size_t)(len + 1)));
+    if(!trimmedText)
+        return;
+    nk_memcopy(trimmedText, text, (nk_size)len);
+    trimmedText[len] = 0;
+    SetClipboardText(trimmedText);
+    MemFree(trimmedText);
+}
+
+/**
+ * Nuklear callback; Allocate memory for Nuklear.
+ *
+ * @internal
+ */
+NK_API void*
+nk_raylib_malloc(nk_handle unused, void *old, nk_size size)
+{
+    NK_UNUSED(unused);
+    NK_UNUSED(old);
+    return MemAlloc((unsigned int)size);
+}
+
+/**
+ * Nuklear callback; Free memory for Nuklear.
+ */
+NK_API void
+nk_raylib_mfree(nk_handle unused, void *ptr)
+{
+    NK_UNUSED(unused);
+    MemFree(ptr);
+}
+
+/**
+ * The alignment of the structures that InitNuklearFixed() places in its memory, and of allocated blocks.
+ *
+ * @internal
+ */
+#define RAYLIB_NUKLEAR_ARENA_ALIGNMENT 16
+
+/**
+ * Round the given size up to RAYLIB_NUKLEAR_ARENA_ALIGNMENT.
+ *
+ * @internal
+ */
+#define RAYLIB_NUKLEAR_ARENA_ALIGN(size) (((size) + (RAYLIB_NUKLEAR_ARENA_ALIGNMENT - 1)) & ~(size_t)(RAYLIB_NUKLEAR_ARENA_ALIGNMENT - 1))
+
+/**
+ * The header in front of each block that a context allocates, which remembers its size for the memory statistics.
+ *
+ * @internal
+ */
+typedef struct NuklearAllocationHeader {
+    size_t size;               // The size of the block, without the header.
+    NuklearMemorySource source; // The buffer that allocated the block.
+} NuklearAllocationHeader;
+
+/**
+ * The size of NuklearAllocationHeader, keeping the blocks after it aligned.
+ *
+ * @internal
+ */
+#define RAYLIB_NUKLEAR_ALLOCATION_HEADER RAYLIB_NUKLEAR_ARENA_ALIGN(sizeof(NuklearAllocationHeader))
+
+/**
+ * NuklearAllocator callback; Allocate memory with raylib's MemAlloc().
+ *
+ * @internal
+ */
+static void*
+raylib_nuklear_mem_alloc(void* userData, nk_size size)
+{
+    NK_UNUSED(userData);
+    return MemAlloc((unsigned int)size);
+}
+
+/**
+ * NuklearAllocator callback; Free memory with raylib's MemFree().
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_mem_free(void* userData, void* ptr)
+{
+    NK_UNUSED(userData);
+    MemFree(ptr);
+}
+
+/**
+ * Nuklear callback; Allocate or reallocate memory through the context's NuklearAllocator, counting it.
+ *
+ * @internal
+ */
+static void*
+raylib_nuklear_tracked_alloc(nk_handle handle, void* old, nk_size size)
+{
+    NuklearAllocationSource* source = (NuklearAllocationSource*)handle.ptr;
+    NuklearMemoryTracker* tracker = source->tracker;
+    NuklearAllocationHeader* header;
+
+    // Nuklear copies the buffer and frees the old block itself, unless the same block is returned.
+    if (old != NULL) {
+        header = (NuklearAllocationHeader*)((unsigned char*)old - RAYLIB_NUKLEAR_ALLOCATION_HEADER);
+        tracker->reallocations++;
+        if (tracker->allocator.resize != NULL && tracker->allocator.resize(tracker->allocator.userData, header, RAYLIB_NUKLEAR_ALLOCATION_HEADER + size)) {
+            tracker->live = tracker->live - header->size + size;
+            tracker->sourceBytes[header->source] = tracker->sourceBytes[header->source] - header->size + size;
+            tracker->peak = NK_MAX(tracker->peak, tracker->live);
+            tracker->inPlaceReallocations++;
+            header->size = size;
+            return old;
+        }
+    }
+
+    header = (NuklearAllocationHeader*)tracker->allocator.alloc(tracker->allocator.userData, RAYLIB_NUKLEAR_ALLOCATION_HEADER + size);
+    if (header == NULL) {
+        return NULL;
+    }
+
+    header->size = size;
+    header->source = source->source;
+    tracker->live += size;
+    tracker->peak = NK_MAX(tracker->peak, tracker->live);
+    tracker->sourceBytes[source->source] += size;
+    tracker->sourceAllocations[source->source]++;
+    tracker->allocations++;
+    return (unsigned char*)header + RAYLIB_NUKLEAR_ALLOCATION_HEADER;
+}
+
+/**
+ * Nuklear callback; Free memory from raylib_nuklear_tracked_alloc().
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_tracked_free(nk_handle handle, void* ptr)
+{
+    if (ptr == NULL) {
+        return;
+    }
+
+    NuklearMemoryTracker* tracker = ((NuklearAllocationSource*)handle.ptr)->tracker;
+    NuklearAllocationHeader* header = (NuklearAllocationHeader*)((unsigned char*)ptr - RAYLIB_NUKLEAR_ALLOCATION_HEADER);
+    tracker->live -= header->size;
+    tracker->sourceBytes[header->source] -= header->size;
+    tracker->allocator.free(tracker->allocator.userData, header);
+}
+
+/**
+ * Set up the memory tracker of a context, with raylib's MemAlloc() and MemFree() when allocator is NULL.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_setup_allocator(NuklearMemoryTracker* tracker, const NuklearAllocator* allocator)
+{
+    nk_zero(tracker, sizeof(NuklearMemoryTracker));
+    if (allocator != NULL) {
+        tracker->allocator = *allocator;
+    }
+    else {
+        tracker->allocator.alloc = raylib_nuklear_mem_alloc;
+        tracker->allocator.free = raylib_nuklear_mem_free;
+    }
+    for (int i = 0; i < NUKLEAR_MEMORY_SOURCE_COUNT; i++) {
+        tracker->sources[i].tracker = tracker;
+        tracker->sources[i].source = (NuklearMemorySource)i;
+    }
+}
+
+/**
+ * Get the Nuklear allocator that allocates for the given buffer of a context.
+ *
+ * @internal
+ */
+static struct nk_allocator
+raylib_nuklear_allocator(NuklearMemoryTracker* tracker, NuklearMemorySource source)
+{
+    struct nk_allocator alloc;
+    alloc.userdata = nk_handle_ptr(&tracker->sources[source]);
+    alloc.alloc = raylib_nuklear_tracked_alloc;
+    alloc.free = raylib_nuklear_tracked_free;
+    return alloc;
+}
+
+/**
+ * Set up the clipboard and the internal user data of a Nuklear context that was just initialized.
+ *
+ * The memory tracker of the user data is set up before Nuklear is, as Nuklear allocates through it.
+ *
+ * @param alloc The allocator for the vertex buffers of DrawNuklearBatched(), or NULL to go without them.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_setup_context(struct nk_context* ctx, NuklearUserData* userData, const struct nk_allocator* alloc)
+{
+    // Clipboard
+    ctx->clip.copy = nk_raylib_clipboard_copy;
+    ctx->clip.paste = nk_raylib_clipboard_paste;
+    ctx->clip.userdata = nk_handle_ptr(0);
+
+    // Set the internal user data.
+    userData->scaling = 1.0f;
+    userData->insert_mode = true;
+    userData->last_left_press = 0.0;
+    userData->double_clicking = false;
+    userData->input_active = false;
+    userData->redraw_frames = RAYLIB_NUKLEAR_REDRAW_FRAMES;
+    userData->frame_tracking = false;
+    userData->frame_hash = 0;
+    userData->frame_hashed = false;
+    userData->frame_hashable = false;
+    userData->frame_seq = 0;
+    userData->frame_seq_hash = 0;
+    userData->polygon_scratch = NULL;
+    userData->polygon_scratch_size = 0;
+    userData->window_cache_enabled = false;
+    userData->window_cache = NULL;
+    userData->window_cache_count = 0;
+    userData->window_cache_capacity = 0;
+    userData->frame = 0;
+    userData->stats = CLITERAL(NuklearRenderStats) {0};
+    userData->sdf_shader = CLITERAL(Shader) {0};
+    userData->atlas = NULL;
+    userData->font_faces = NULL;
+    userData->font_face_count = 0;
+    userData->fonts = NULL;
+    userData->font_count = 0;
+    userData->font_capacity = 0;
+    userData->wrap_texts = NULL;
+    userData->wrap_text_count = 0;
+    userData->wrap_text_capacity = 0;
+    userData->wrap_slots = NULL;
+    userData->wrap_slot_count = 0;
+    userData->wrap_seq = 0;
+    userData->text_runs = CLITERAL(NuklearTextRunCache) {0};
+    userData->arena = NULL;
+    userData->arena_size = 0;
+    userData->arena_header = 0;
+    userData->arena_peak = 0;
+    userData->arena_overflow = false;
+    nk_zero(&userData->commands_plan, sizeof(NuklearCommandPlanner));
+    nk_zero(&userData->states, sizeof(NuklearStateIndex));
+    nk_zero(&userData->hash_memo, sizeof(NuklearHashMemo));
+    userData->hash_memo.frame = 1;
+    userData->commands_plan.shrinkFrames = RAYLIB_NUKLEAR_COMMAND_SHRINK_FRAMES;
+#ifdef RAYLIB_NUKLEAR_USE_VERTEX_BUFFER
+    if (alloc != NULL) {
+        nk_buffer_init(&userData->commands, alloc, NK_BUFFER_DEFAULT_INITIAL_SIZE);
+        nk_buffer_init(&userData->vertices, alloc, NK_BUFFER_DEFAULT_INITIAL_SIZE);
+        nk_buffer_init(&userData->elements, alloc, NK_BUFFER_DEFAULT_INITIAL_SIZE);
+    }
+    else {
+        nk_zero(&userData->commands, sizeof(struct nk_buffer));
+        nk_zero(&userData->vertices, sizeof(struct nk_buffer));
+        nk_zero(&userData->elements, sizeof(struct nk_buffer));
+    }
+#else
+    NK_UNUSED(alloc);
+#endif
+    nk_handle userDataHandle;
+    userDataHandle.id = 1;
+    userDataHandle.ptr = (void*)userData;
+    nk_set_user_data(ctx, userDataHandle);
+}
+
+/**
+ * Initialize the Nuklear context for use with Raylib, with the given Nuklear user font.
+ *
+ * @param userFont The Nuklear user font to initialize the Nuklear context with, like one from LoadNuklearFont() or
+ *                 LoadNuklearDynamicFont(). UnloadNuklear() unloads it along with the context.
+ */
+NK_API struct nk_context*
+InitNuklearContext(struct nk_user_font* userFont)
+{
+    return InitNuklearWithAllocator(userFont, NULL);
+}
+
+/**
+ * Initialize the Nuklear context for use with Raylib, allocating Nuklear's memory with the given allocator.
+ *
+ * Nuklear's command buffer, its pool pages, the buffers of DrawNuklearBatched() and text edits from
+ * nk_raylib_textedit_init() are allocated through the allocator, and GetNuklearMemoryStats() reports how much each of
+ * them uses. The context itself and the caches of optional features are allocated with raylib's MemAlloc().
+ *
+ * @param userFont The Nuklear user font to initialize the Nuklear context with. UnloadNuklear() unloads it along with the context.
+ * @param allocator The allocator to use, which is copied, or NULL to use raylib's MemAlloc() and MemFree().
+ *
+ * @return The nuklear context, or NULL on error.
+ *
+ * @see GetNuklearMemoryStats()
+ */
+NK_API struct nk_context*
+InitNuklearWithAllocator(struct nk_user_font* userFont, const NuklearAllocator* allocator)
+{
+    if (allocator != NULL && (allocator->alloc == NULL || allocator->free == NULL)) {
+        TraceLog(LOG_ERROR, "NUKLEAR: The allocator needs both alloc and free callbacks");
+        return NULL;
+    }
+
+    struct nk_context* ctx = (struct nk_context*)MemAlloc(sizeof(struct nk_context));
+    if (ctx == NULL) {
+        TraceLog(LOG_ERROR, "NUKLEAR: Failed to initialize nuklear memory");
+        return NULL;
+    }
+
+    struct NuklearUserData* userData = (struct NuklearUserData*)MemAlloc(sizeof(struct NuklearUserData));
+    if (userData == NULL) {
+        TraceLog(LOG_ERROR, "NUKLEAR: Failed to initialize nuklear user data");
+        MemFree(ctx);
+        return NULL;
+    }
+
+    // Allocator, with one handle per buffer to tell their memory apart.
+    raylib_nuklear_setup_allocator(&userData->memory, allocator);
+    struct nk_allocator alloc = raylib_nuklear_allocator(&userData->memory, NUKLEAR_MEMORY_COMMANDS);
+
+    // Initialize the context.
+    if (!nk_init(ctx, &alloc, userFont)) {
+        TraceLog(LOG_ERROR, "NUKLEAR: Failed to initialize nuklear");
+        MemFree(ctx);
+        MemFree(userData);
+        return NULL;
+    }
+    ctx->pool.alloc = raylib_nuklear_allocator(&userData->memory, NUKLEAR_MEMORY_POOL);
+
+    alloc = raylib_nuklear_allocator(&userData->memory, NUKLEAR_MEMORY_VERTEX_BUFFERS);
+    raylib_nuklear_setup_context(ctx, userData, &alloc);
+    TraceLog(LOG_INFO, "NUKLEAR: Initialized GUI");
+
+    return ctx;
+}
+
+/**
+ * Fill in a Nuklear user font that draws with raylib's default font.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_setup_default_user_font(struct nk_user_font* userFont, float fontSize)
+{
+    // Use the default font size if desired.
+    if (fontSize <= 0.0f) {
+        fontSize = (float)RAYLIB_NUKLEAR_DEFAULT_FONTSIZE;
+    }
+
+    userFont->height = fontSize;
+    userFont->width = nk_raylib_font_get_text_width;
+    userFont->userdata = nk_handle_ptr(0);
+#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+    userFont->query = nk_raylib_font_query_font_glyph;
+    userFont->texture = nk_handle_id((int)GetFontDefault().texture.id);
+#endif
+}
+
+/**
+ * Fill in a Nuklear font for the given raylib font.
+ *
+ * @param map Whether to build a hash map of the font's codepoints from 256 up, which allocates memory.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_setup_font(NuklearFont* newFont, Font font, bool map)
+{
+    newFont->font = font;
+    newFont->dynamic = NULL;
+    newFont->sdf = false;
+    newFont->nextSDF = NULL;
+    newFont->references = 1;
+    newFont->ownsFont = false;
+    newFont->nextShared = NULL;
+    raylib_nuklear_load_glyph_advances(&newFont->advances, &font, map);
+}
+
+/**
+ * Fill in a Nuklear user font that draws with the given Nuklear font.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_setup_user_font(struct nk_user_font* userFont, NuklearFont* font, float fontSize)
+{
+    // Use the default font size if desired.
+    if (fontSize <= 0.0f) {
+        fontSize = (float)RAYLIB_NUKLEAR_DEFAULT_FONTSIZE;
+    }
+
+    userFont->userdata = nk_handle_ptr(font);
+    userFont->height = fontSize;
+    userFont->width = nk_raylib_font_get_text_width_user_font;
+#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+    userFont->query = nk_raylib_font_query_font_glyph_user_font;
+    userFont->texture = nk_handle_id((int)font->font.texture.id);
+#endif
+}
+
+/**
+ * Initialize the Nuklear context for use with Raylib.
+ *
+ * @param fontSize The size of the font to use for GUI text. Use 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ *
+ * @return The nuklear context, or NULL on error.
+ */
+NK_API struct nk_context*
+InitNuklear(int fontSize)
+{
+    // User font.
+    struct nk_user_font* userFont = (struct nk_user_font*)MemAlloc(sizeof(struct nk_user_font));
+    if (userFont == NULL) {
+        TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate nuklear font");
+        return NULL;
+    }
+
+    raylib_nuklear_setup_default_user_font(userFont, (float)fontSize);
+
+    // Nuklear context.
+    return InitNuklearContext(userFont);
+}
+
+/**
+ * Initialize the Nuklear context for use with Raylib, with a supplied custom font.
+ *
+ * @param font The custom raylib font to use with Nuklear.
+ * @param fontSize The desired size of the font. Use 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ *
+ * @return The nuklear context, or NULL on error.
+ */
+NK_API struct nk_context*
+InitNuklearEx(Font font, float fontSize)
+{
+    struct nk_user_font* userFont = LoadNuklearFont(font, fontSize);
+    if (userFont == NULL) {
+        return NULL;
+    }
+
+    // Nuklear context.
+    return InitNuklearContext(userFont);
+}
+
+/**
+ * Initialize the Nuklear context for use with Raylib, with a signed distance field font loaded from the given file.
+ *
+ * @param fileName The TTF or OTF font file.
+ * @param fontSize The desired size of the font. Use 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ *
+ * @return The nuklear context, or NULL on error. UnloadNuklear() unloads the font along with it.
+ *
+ * @see LoadNuklearSDFFont()
+ */
+NK_API struct nk_context*
+InitNuklearSDF(const char* fileName, float fontSize)
+{
+    struct nk_user_font* userFont = LoadNuklearSDFFont(fileName, fontSize);
+    if (userFont == NULL) {
+        return NULL;
+    }
+
+    // Nuklear context.
+    return InitNuklearContext(userFont);
+}
+
+/**
+ * Initialize a Nuklear context inside the given memory, with raylib's default font when font is NULL.
+ *
+ * @internal
+ */
+static struct nk_context*
+raylib_nuklear_init_fixed(void* memory, nk_size size, const Font* font, float fontSize)
+{
+    if (memory == NULL) {
+        return NULL;
+    }
+
+    // The context, its user data and its font go at the start of the memory, and Nuklear gets the rest.
+    nk_size padding = 0;
+    unsigned char* start = (unsigned char*)nk_buffer_align(memory, RAYLIB_NUKLEAR_ARENA_ALIGNMENT, &padding, NK_BUFFER_FRONT);
+    size_t header = padding + RAYLIB_NUKLEAR_ARENA_ALIGN(sizeof(struct nk_context)) + RAYLIB_NUKLEAR_ARENA_ALIGN(sizeof(NuklearUserData)) +
+        RAYLIB_NUKLEAR_ARENA_ALIGN(sizeof(struct nk_user_font)) + ((font != NULL) ? RAYLIB_NUKLEAR_ARENA_ALIGN(sizeof(NuklearFont)) : 0);
+    if (size < header + sizeof(struct nk_page_element)) {
+        TraceLog(LOG_ERROR, "NUKLEAR: The fixed memory needs to be larger than %i bytes", (int)(header + sizeof(struct nk_page_element)));
+        return NULL;
+    }
+
+    struct nk_context* ctx = (struct nk_context*)start;
+    start += RAYLIB_NUKLEAR_ARENA_ALIGN(sizeof(struct nk_context));
+    NuklearUserData* userData = (NuklearUserData*)start;
+    start += RAYLIB_NUKLEAR_ARENA_ALIGN(sizeof(NuklearUserData));
+    struct nk_user_font* userFont = (struct nk_user_font*)start;
+    start += RAYLIB_NUKLEAR_ARENA_ALIGN(sizeof(struct nk_user_font));
+    if (font != NULL) {
+        // Codepoints from 256 up are searched for, as their hash map would need allocating.
+        NuklearFont* newFont = (NuklearFont*)start;
+        start += RAYLIB_NUKLEAR_ARENA_ALIGN(sizeof(NuklearFont));
+        raylib_nuklear_setup_font(newFont, *font, false);
+        raylib_nuklear_setup_user_font(userFont, newFont, fontSize);
+    }
+    else {
+        raylib_nuklear_setup_default_user_font(userFont, fontSize);
+    }
+
+    raylib_nuklear_setup_allocator(&userData->memory, NULL);
+    if (!nk_init_fixed(ctx, start, size - header, userFont)) {
+        TraceLog(LOG_ERROR, "NUKLEAR: Failed to initialize nuklear");
+        return NULL;
+    }
+
+    raylib_nuklear_setup_context(ctx, userData, NULL);
+    userData->arena = memory;
+    userData->arena_size = size;
+    userData->arena_header = header;
+    userData->arena_peak = header;
+    TraceLog(LOG_INFO, "NUKLEAR: Initialized GUI in %i bytes of fixed memory", (int)size);
+
+    return ctx;
+}
+
+/**
+ * Initialize the Nuklear context inside the given memory, drawing text with raylib's default font.
+ *
+ * The context, its internal user data and its font are placed at the start of the memory, and Nuklear's commands and
+ * windows use the rest of it, so the context never allocates while building and drawing frames. Optional features
+ * that keep their own caches, like the window cache, the texture atlas and the font registry, still allocate when
+ * they're used. Text is drawn and wrapped without its caches, and DrawNuklearBatched() draws like DrawNuklear(). When a frame doesn't fit, the
+ * commands and windows that didn't fit are dropped, which GetNuklearMemoryStats() reports along with the most
+ * memory that was used.
+ *
+ * @param memory The memory for the context, which needs to stay valid until UnloadNuklear().
+ * @param size The size of the memory, in bytes.
+ * @param fontSize The size of the font to use for GUI text. Use 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ *
+ * @return The nuklear context, or NULL when the memory is too small. UnloadNuklear() leaves the memory to the caller.
+ *
+ * @code
+ * static unsigned char memory[256 * 1024];
+ * struct nk_context* ctx = InitNuklearFixed(memory, sizeof(memory), 0);
+ * @endcode
+ *
+ * @see GetNuklearMemoryStats()
+ */
+NK_API struct nk_context*
+InitNuklearFixed(void* memory, nk_size size, int fontSize)
+{
+    return raylib_nuklear_init_fixed(memory, size, NULL, (float)fontSize);
+}
+
+/**
+ * Initialize the Nuklear context inside the given memory, with a custom font.
+ *
+ * @param memory The memory for the context, which needs to stay valid until UnloadNuklear().
+ * @param size The size of the memory, in bytes.
+ * @param font The custom raylib font, which needs to stay loaded until UnloadNuklear(). Codepoints from 256 up are
+ *             searched for in its glyphs, as a table to look them up in would need allocating.
+ * @param fontSize The desired size of the font. Use 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ *
+ * @return The nuklear context, or NULL when the memory is too small.
+ *
+ * @see InitNuklearFixed()
+ */
+NK_API struct nk_context*
+InitNuklearFixedEx(void* memory, nk_size size, Font font, float fontSize)
+{
+    return raylib_nuklear_init_fixed(memory, size, &font, fontSize);
+}
+
+/**
+ * Build a Nuklear font from the given raylib font, with everything Nuklear needs to measure and draw its text.
+ *
+ * Besides the text width, the font answers Nuklear's glyph queries with the glyph's UVs from font.recs, its advance
+ * and offsets, and its texture id is set, so DrawNuklearBatched() tessellates text into the same vertex buffer as
+ * every other shape. DrawNuklear() draws it with DrawTextEx().
+ *
+ * Building a Nuklear font from a raylib font that's already in use shares the glyph tables of the first one, so that
+ * several contexts initialized with InitNuklearEx() and the same font don't each keep their own.
+ *
+ * @param font The raylib font. It needs to stay loaded while the Nuklear font is used.
+ * @param fontSize The size of the text. Use 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ *
+ * @return The Nuklear font, or NULL on error. Unload it with UnloadNuklearFont() once no context uses it anymore.
+ *
+ * @note Use it with nk_style_push_font(), as UnloadNuklear() unloads the context's own font.
+ *
+ * @code
+ * struct nk_user_font* title = LoadNuklearFont(font, 24.0f);
+ * nk_style_push_font(ctx, title);
+ * nk_label(ctx, "Title", NK_TEXT_LEFT);
+ * nk_style_pop_font(ctx);
+ * @endcode
+ */
+NK_API struct nk_user_font*
+LoadNuklearFont(Font font, float fontSize)
+{
+    struct nk_user_font* userFont = (struct nk_user_font*)MemAlloc(sizeof(struct nk_user_font));
+    if (userFont == NULL) {
+        TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate nuklear font");
+        return NULL;
+    }
+
+    // Share the glyph tables of the raylib font when it's already loaded, or copy it to a new raylib font pointer.
+    NuklearFont* newFont = raylib_nuklear_shared_fonts;
+    while (newFont != NULL && (font.texture.id == 0 || newFont->font.texture.id != font.texture.id ||
+            newFont->font.glyphs != font.glyphs || newFont->font.recs != font.recs ||
+            newFont->font.glyphCount != font.glyphCount || newFont->font.baseSize != font.baseSize)) {
+        newFont = newFont->nextShared;
+    }
+    if (newFont != NULL) {
+        newFont->references++;
+        raylib_nuklear_setup_user_font(userFont, newFont, fontSize);
+        return userFont;
+    }
+
+    newFont = (NuklearFont*)MemAlloc(sizeof(NuklearFont));
+    if (newFont == NULL) {
+        TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate font");
+        MemFree(userFont);
+        return NULL;
+    }
+    raylib_nuklear_setup_font(newFont, font, true);
+    raylib_nuklear_setup_user_font(userFont, newFont, fontSize);
+    if (font.texture.id != 0) {
+        newFont->nextShared = raylib_nuklear_shared_fonts;
+        raylib_nuklear_shared_fonts = newFont;
+    }
+
+    return userFont;
+}
+
+/**
+ * Get another Nuklear font of the same font as the given one, at the given size.
+ *
+ * The fonts share one set of glyph tables and, for dynamic and signed distance field fonts, one glyph atlas, so
+ * contexts that show the same font don't each build their own. Each font is unloaded with UnloadNuklearFont(), or with
+ * UnloadNuklear() when it's a context's font, and the font data is unloaded along with the last of them.
+ *
+ * @param userFont A Nuklear font from InitNuklear(), LoadNuklearFont(), LoadNuklearDynamicFont(), LoadNuklearSDFFont()
+ * or GetNuklearFont().
+ * @param fontSize The size of the text. Use 0 to keep the size of the given font.
+ *
+ * @return The shared Nuklear font, or NULL on error.
+ *
+ * @code
+ * struct nk_context* ui = InitNuklearSDF("resources/ui.ttf", 16.0f);
+ * struct nk_context* overlay = InitNuklearContext(ShareNuklearFont(ui->style.font, 12.0f));
+ * @endcode
+ */
+NK_API struct nk_user_font*
+ShareNuklearFont(const struct nk_user_font* userFont, float fontSize)
+{
+    if (userFont == NULL) {
+        return NULL;
+    }
+
+    struct nk_user_font* sharedFont = (struct nk_user_font*)MemAlloc(sizeof(struct nk_user_font));
+    if (sharedFont == NULL) {
+        TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate nuklear font");
+        return NULL;
+    }
+    *sharedFont = *userFont;
+    if (fontSize > 0.0f) {
+        sharedFont->height = fontSize;
+    }
+
+    NuklearFont* font = (NuklearFont*)userFont->userdata.ptr;
+    if (font != NULL) {
+        font->references++;
+    }
+
+    return sharedFont;
+}
+
+/**
+ * Unload a Nuklear font that was built with LoadNuklearFont(). The raylib font it was built from stays loaded.
+ *
+ * Fonts that share their glyph tables, through ShareNuklearFont() or by loading the same raylib font, keep them until
+ * the last of them is unloaded.
+ *
+ * @param userFont The Nuklear font.
+ */
+NK_API void
+UnloadNuklearFont(struct nk_user_font* userFont)
+{
+    if (userFont == NULL) {
+        return;
+    }
+
+    // Clear the raylib Font object, once no other Nuklear font shares it.
+    NuklearFont* font = (NuklearFont*)userFont->userdata.ptr;
+    if (font != NULL && --font->references <= 0) {
+        NuklearFont** shared = &raylib_nuklear_shared_fonts;
+        while (*shared != NULL && *shared != font) {
+            shared = &(*shared)->nextShared;
+        }
+        if (*shared != NULL) {
+            *shared = font->nextShared;
+        }
+        if (font->dynamic != NULL) {
+            // Dynamic fonts own their glyphs and texture.
+            NuklearDynamicFont** link = &raylib_nuklear_dynamic_fonts;
+            while (*link != NULL && *link != font->dynamic) {
+                link = &(*link)->next;
+            }
+            if (*link != NULL) {
+                *link = font->dynamic->next;
+            }
+            UnloadTexture(font->dynamic->texture);
+            UnloadImage(font->dynamic->image);
+            MemFree(font->dynamic->fileData);
+            MemFree(font->dynamic->glyphPages);
+            MemFree(font->dynamic);
+            MemFree(font->font.glyphs);
+            MemFree(font->font.recs);
+        }
+        if (font->sdf) {
+            // SDF fonts own their font, and the last one unloads the shader.
+            NuklearFont** link = &raylib_nuklear_sdf_fonts;
+            while (*link != NULL && *link != font) {
+                link = &(*link)->nextSDF;
+            }
+            if (*link != NULL) {
+                *link = font->nextSDF;
+            }
+            if (raylib_nuklear_sdf_fonts == NULL) {
+                if (raylib_nuklear_sdf_text_shader.id != 0) {
+                    UnloadShader(raylib_nuklear_sdf_text_shader);
+                }
+                raylib_nuklear_sdf_text_shader = CLITERAL(Shader) {0};
+                raylib_nuklear_sdf_text_shader_loaded = false;
+            }
+        }
+        if (font->ownsFont) {
+            UnloadFont(font->font);
+        }
+        raylib_nuklear_unload_glyph_advances(&font->advances);
+        MemFree(font);
+    }
+
+    // Clear the user font.
+    MemFree(userFont);
+}
+
+/**
+ * Create a dynamic font from the given font file data, taking ownership of it.
+ *
+ * @internal
+ */
+static struct nk_user_font*
+raylib_nuklear_load_dynamic_font(unsigned char* fileData, int dataSize, float fontSize)
+{
+    if (fontSize <= 0.0f) {
+        fontSize = (float)RAYLIB_NUKLEAR_DEFAULT_FONTSIZE;
+    }
+
+    NuklearFont* newFont = (NuklearFont*)MemAlloc(sizeof(NuklearFont));
+    NuklearDynamicFont* dynamic = (NuklearDynamicFont*)MemAlloc(sizeof(NuklearDynamicFont));
+    struct nk_user_font* userFont = (struct nk_user_font*)MemAlloc(sizeof(struct nk_user_font));
+    if (newFont == NULL || dynamic == NULL || userFont == NULL) {
+        TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate dynamic font");
+        MemFree(newFont);
+        MemFree(dynamic);
+        MemFree(userFont);
+        MemFree(fileData);
+        return NULL;
+    }
+    nk_memset(newFont, 0, sizeof(NuklearFont));
+    nk_memset(dynamic, 0, sizeof(NuklearDynamicFont));
+    dynamic->fileData = fileData;
+    dynamic->dataSize = dataSize;
+    newFont->dynamic = dynamic;
+    newFont->references = 1;
+    userFont->userdata = nk_handle_ptr(newFont);
+    userFont->height = fontSize;
+    userFont->width = nk_raylib_font_get_text_width_user_font;
+
+    // The glyph atlas starts out empty, as gray and alpha like raylib's font atlases.
+    const int size = RAYLIB_NUKLEAR_DYNAMIC_FONT_ATLAS_SIZE;
+    dynamic->image = CLITERAL(Image) {MemAlloc((unsigned int)((size_t)size * (size_t)size * 2)), size, size, 1, PIXELFORMAT_UNCOMPRESSED_GRAY_ALPHA};
+    if (dynamic->image.data != NULL) {
+        nk_memset(dynamic->image.data, 0, (nk_size)size * (nk_size)size * 2);
+        dynamic->texture = LoadTextureFromImage(dynamic->image);
+    }
+    dynamic->next = raylib_nuklear_dynamic_fonts;
+    raylib_nuklear_dynamic_fonts = dynamic;
+    newFont->font.baseSize = (int)(fontSize + 0.5f);
+    newFont->font.glyphPadding = 1;
+    newFont->font.texture = dynamic->texture;
+    newFont->advances.texture = dynamic->texture.id;
+#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+    userFont->query = nk_raylib_font_query_font_glyph_user_font;
+    userFont->texture = nk_handle_id((int)dynamic->texture.id);
+#endif
+
+    // Start with printable ASCII, which includes the '?' that missing glyphs fall back to.
+    int ascii[95];
+    for (int i = 0; i < 95; i++) {
+        ascii[i] = 32 + i;
+    }
+    if (dynamic->texture.id != 0) {
+        raylib_nuklear_dynamic_font_load_glyphs(newFont, ascii, 95);
+    }
+    int fallback = newFont->advances.latin1Index['?'];
+    if (newFont->font.glyphCount == 0 || newFont->font.glyphs[fallback].value != '?') {
+        TraceLog(LOG_WARNING, "NUKLEAR: Failed to load dynamic font");
+        UnloadNuklearFont(userFont);
+        return NULL;
+    }
+    newFont->advances.fallbackIndex = fallback;
+    newFont->advances.fallback = newFont->advances.latin1[fallback];
+    for (int i = 0; i < 256; i++) {
+        if (newFont->font.glyphs[newFont->advances.latin1Index[i]].value != i) {
+            newFont->advances.latin1[i] = newFont->advances.fallback;
+            newFont->advances.latin1Index[i] = fallback;
+        }
+    }
+
+    return userFont;
+}
+
+/**
+ * Load a font that rasterizes its glyphs the first time text is measured or drawn with them.
+ *
+ * Only the printable ASCII glyphs are rasterized up front, so fonts with large character sets, like Chinese or
+ * Japanese, load without baking every glyph. The font file stays in memory to rasterize more glyphs from, and they're
+ * packed into a glyph atlas of RAYLIB_NUKLEAR_DYNAMIC_FONT_ATLAS_SIZE pixels that's uploaded once per frame. When the
+ * atlas is full, its least recently used page of glyphs is evicted.
+ *
+ * @param fileName The TTF or OTF font file.
+ * @param fontSize The size of the text, which glyphs are rasterized at. Use 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ *
+ * @return The Nuklear font, or NULL on error. Unload it with UnloadNuklearFont().
+ *
+ * @code
+ * struct nk_context* ctx = InitNuklearContext(LoadNuklearDynamicFont("NotoSansCJK.otf", 20.0f));
+ * @endcode
+ */
+NK_API struct nk_user_font*
+LoadNuklearDynamicFont(const char* fileName, float fontSize)
+{
+    int dataSize = 0;
+    unsigned char* fileData = LoadFileData(fileName, &dataSize);
+    if (fileData == NULL || dataSize <= 0) {
+        TraceLog(LOG_WARNING, "NUKLEAR: Failed to load dynamic font %s", fileName);
+        UnloadFileData(fileData);
+        return NULL;
+    }
+
+    return raylib_nuklear_load_dynamic_font(fileData, dataSize, fontSize);
+}
+
+/**
+ * Load a dynamic font from the given TTF or OTF data.
+ *
+ * @param fileData The font file data, which is copied.
+ * @param dataSize The size of the data.
+ * @param fontSize The size of the text. Use 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ *
+ * @return The Nuklear font, or NULL on error. Unload it with UnloadNuklearFont().
+ *
+ * @see LoadNuklearDynamicFont()
+ */
+NK_API struct nk_user_font*
+LoadNuklearDynamicFontFromMemory(const unsigned char* fileData, int dataSize, float fontSize)
+{
+    if (fileData == NULL || dataSize <= 0) {
+        return NULL;
+    }
+
+    unsigned char* copy = (unsigned char*)MemAlloc((unsigned int)dataSize);
+    if (copy == NULL) {
+        TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate dynamic font");
+        return NULL;
+    }
+    nk_memcopy(copy, fileData, (nk_size)dataSize);
+
+    return raylib_nuklear_load_dynamic_font(copy, dataSize, fontSize);
+}
+
+/**
+ * Load a font with signed distance field glyphs, which draw crisp text at any size or scaling from a single atlas.
+ *
+ * The glyphs are generated with raylib's FONT_SDF at RAYLIB_NUKLEAR_SDF_FONT_SIZE, and text is drawn with a signed
+ * distance field shader. Use it when the GUI is zoomed continuously, where baking the font at every size isn't an
+ * option. Without shader support, the glyphs are drawn as they are, which looks blurry.
+ *
+ * @param fileName The TTF or OTF font file.
+ * @param fontSize The size of the text. Use 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ *
+ * @return The Nuklear font, or NULL on error. Unload it with UnloadNuklearFont(), which also unloads its raylib font.
+ *
+ * @see InitNuklearSDF()
+ */
+NK_API struct nk_user_font*
+LoadNuklearSDFFont(const char* fileName, float fontSize)
+{
+    int dataSize = 0;
+    unsigned char* fileData = LoadFileData(fileName, &dataSize);
+    if (fileData == NULL || dataSize <= 0) {
+        TraceLog(LOG_WARNING, "NUKLEAR: Failed to load SDF font %s", fileName);
+        UnloadFileData(fileData);
+        return NULL;
+    }
+
+    // Generate the printable ASCII glyphs, as raylib's SDF example does.
+    Font font = {0};
+    font.baseSize = RAYLIB_NUKLEAR_SDF_FONT_SIZE;
+#if RAYLIB_VERSION_MAJOR >= 6
+    font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, NULL, 95, FONT_SDF, &font.glyphCount);
+#else
+    font.glyphCount = 95;
+    font.glyphs = LoadFontData(fileData, dataSize, font.baseSize, NULL, font.glyphCount, FONT_SDF);
+#endif
+    UnloadFileData(fileData);
+    if (font.glyphs == NULL || font.glyphCount <= 0) {
+        TraceLog(LOG_WARNING, "NUKLEAR: Failed to generate SDF font %s", fileName);
+        return NULL;
+    }
+    Image atlas = GenImageFontAtlas(font.glyphs, &font.recs, font.glyphCount, font.baseSize, 0, 1);
+    font.texture = LoadTextureFromImage(atlas);
+    UnloadImage(atlas);
+    SetTextureFilter(font.texture, TEXTURE_FILTER_BILINEAR);
+
+    struct nk_user_font* userFont = LoadNuklearFont(font, fontSize);
+    if (userFont == NULL) {
+        UnloadFont(font);
+        return NULL;
+    }
+    NuklearFont* sdfFont = (NuklearFont*)userFont->userdata.ptr;
+    sdfFont->sdf = true;
+    sdfFont->ownsFont = true;
+    sdfFont->nextSDF = raylib_nuklear_sdf_fonts;
+    raylib_nuklear_sdf_fonts = sdfFont;
+
+    return userFont;
+}
+
+/**
+ * Bake a registered font at its logical size times the given scaling, replacing the glyphs it had.
+ *
+ * The Nuklear font keeps its address and logical height, so contexts and styles that use it pick up the new glyphs.
+ *
+ * @return True when the font was baked, false when it kept its previous glyphs.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_bake_registered_font(NuklearUserData* userData, NuklearRegisteredFont* registered, float scale)
+{
+    NuklearFontFace* face = &userData->font_faces[registered->face];
+    int pixelSize = NK_MAX((int)(registered->size * scale + 0.5f), 1);
+    Font font = LoadFontFromMemory(GetFileExtension(face->fileName), face->fileData, face->dataSize, pixelSize, NULL, 0);
+    if (font.texture.id == 0 || font.texture.id == GetFontDefault().texture.id) {
+        TraceLog(LOG_WARNING, "NUKLEAR: Failed to bake font %s at %i pixels", face->fileName, pixelSize);
+        return false;
+    }
+
+    NuklearFont* newFont = (NuklearFont*)registered->userFont->userdata.ptr;
+    if (newFont->font.texture.id != 0) {
+        UnloadFont(newFont->font);
+    }
+    raylib_nuklear_unload_glyph_advances(&newFont->advances);
+    newFont->font = font;
+    raylib_nuklear_load_glyph_advances(&newFont->advances, &font, true);
+    registered->scale = scale;
+#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+    registered->userFont->texture = nk_handle_id((int)font.texture.id);
+#endif
+    return true;
+}
+
+/**
+ * Bake the registered fonts of a context again when they don't match its scaling.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_bake_registered_fonts(NuklearUserData* userData)
+{
+    for (int i = 0; i < userData->font_count; i++) {
+        if (userData->fonts[i].scale != userData->scaling) {
+            raylib_nuklear_bake_registered_font(userData, &userData->fonts[i], userData->scaling);
+        }
+    }
+}
+
+/**
+ * Find which registered font the given Nuklear font is.
+ *
+ * @return The registered font, or NULL when the font isn't from the font registry.
+ *
+ * @internal
+ */
+static NuklearRegisteredFont*
+raylib_nuklear_find_registered_font(NuklearUserData* userData, const struct nk_user_font* userFont)
+{
+    for (int i = 0; i < userData->font_count; i++) {
+        if (userData->fonts[i].userFont == userFont) {
+            return &userData->fonts[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Unload the font registry of a context, along with its fonts.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_unload_font_registry(NuklearUserData* userData)
+{
+    for (int i = 0; i < userData->font_count; i++) {
+        UnloadNuklearFont(userData->fonts[i].userFont);
+    }
+    for (int i = 0; i < userData->font_face_count; i++) {
+        MemFree(userData->font_faces[i].fileName);
+        UnloadFileData(userData->font_faces[i].fileData);
+    }
+    MemFree(userData->fonts);
+    MemFree(userData->font_faces);
+    userData->fonts = NULL;
+    userData->font_faces = NULL;
+    userData->font_count = userData->font_face_count = userData->font_capacity = 0;
+}
+
+/**
+ * Get a font from the context's font registry, loading it the first time it's asked for.
+ *
+ * Text is laid out at the font's logical size, while its glyphs are baked at the size times the context's scaling, so
+ * that scaled text is drawn pixel for pixel rather than stretched. SetNuklearScaling() bakes the registered fonts
+ * again at the new scaling. Each font file is loaded once and shared by all of its sizes, and fonts that are already
+ * registered are returned without allocating, so it's fine to call this every frame.
+ *
+ * @param ctx The Nuklear context, which owns the font and unloads it in UnloadNuklear().
+ * @param fileName The TTF or OTF font file.
+ * @param fontSize The logical size of the font. Use 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ *
+ * @return The Nuklear font, or NULL on error. Don't unload it with UnloadNuklearFont().
+ *
+ * @code
+ * nk_style_push_font(ctx, GetNuklearFont(ctx, "resources/heading.ttf", 24.0f));
+ * nk_label(ctx, "Settings", NK_TEXT_LEFT);
+ * nk_style_pop_font(ctx);
+ * @endcode
+ */
+NK_API struct nk_user_font*
+GetNuklearFont(struct nk_context* ctx, const char* fileName, float fontSize)
+{
+    if (ctx == NULL || fileName == NULL || ctx->userdata.ptr == NULL) {
+        return NULL;
+    }
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
     if (fontSize <= 0.0f) {
         fontSize = (float)RAYLIB_NUKLEAR_DEFAULT_FONTSIZE;
     }
-    newFont->baseSize = font.baseSize;
-    newFont->glyphCount = font.glyphCount;
-    newFont->glyphPadding = font.glyphPadding;
-    newFont->glyphs = font.glyphs;
-    newFont->recs = font.recs;
-    newFont->texture = font.texture;
 
-    // Create the nuklear user font.
-    struct nk_user_font* userFont = (struct nk_user_font*)MemAlloc(sizeof(struct nk_user_font));
-    if (userFont == NULL) {
-        TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate nuklear font");
-        MemFree(newFont);
-        return NULL;
+    // Find the face, and the font when it's registered.
+    int face = -1;
+    for (int i = 0; i < userData->font_face_count && face < 0; i++) {
+        if (TextIsEqual(userData->font_faces[i].fileName, fileName)) {
+            face = i;
+        }
+    }
+    for (int i = 0; i < userData->font_count && face >= 0; i++) {
+        if (userData->fonts[i].face == face && userData->fonts[i].size == fontSize) {
+            return userData->fonts[i].userFont;
+        }
+    }
+
+    // Make room for a new font, and its face.
+    if (userData->font_count == userData->font_capacity) {
+        int capacity = (userData->font_capacity == 0) ? 4 : userData->font_capacity * 2;
+        NuklearRegisteredFont* fonts = (NuklearRegisteredFont*)MemRealloc(userData->fonts, (unsigned int)((size_t)capacity * sizeof(NuklearRegisteredFont)));
+        if (fonts != NULL) userData->fonts = fonts;
+        NuklearFontFace* faces = (NuklearFontFace*)MemRealloc(userData->font_faces, (unsigned int)((size_t)capacity * sizeof(NuklearFontFace)));
+        if (faces != NULL) userData->font_faces = faces;
+        if (fonts == NULL || faces == NULL) {
+            TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate the font registry");
+            return NULL;
+        }
+        userData->font_capacity = capacity;
+    }
+
+    bool newFace = face < 0;
+    if (newFace) {
+        NuklearFontFace* fontFace = &userData->font_faces[userData->font_face_count];
+        fontFace->fileData = LoadFileData(fileName, &fontFace->dataSize);
+        if (fontFace->fileData == NULL || fontFace->dataSize <= 0) {
+            TraceLog(LOG_WARNING, "NUKLEAR: Failed to load font %s", fileName);
+            UnloadFileData(fontFace->fileData);
+            return NULL;
+        }
+        unsigned int length = TextLength(fileName);
+        fontFace->fileName = (char*)MemAlloc(length + 1);
+        if (fontFace->fileName == NULL) {
+            UnloadFileData(fontFace->fileData);
+            return NULL;
+        }
+        nk_memcopy(fontFace->fileName, fileName, (nk_size)length + 1);
+        face = userData->font_face_count++;
+    }
+
+    // Bake the new font at the context's scaling.
+    NuklearRegisteredFont* registered = &userData->fonts[userData->font_count];
+    registered->face = face;
+    registered->size = fontSize;
+    registered->scale = userData->scaling;
+    registered->userFont = LoadNuklearFont(CLITERAL(Font) {0}, fontSize);
+    if (registered->userFont == NULL || !raylib_nuklear_bake_registered_font(userData, registered, userData->scaling)) {
+        UnloadNuklearFont(registered->userFont);
+        if (newFace) {
+            userData->font_face_count--;
+            MemFree(userData->font_faces[face].fileName);
+            UnloadFileData(userData->font_faces[face].fileData);
+        }
+        return NULL;
+    }
+    ((NuklearFont*)registered->userFont->userdata.ptr)->ownsFont = true;
+    userData->font_count++;
+
+    return registered->userFont;
+}
+
+/**
+ * The starting value for raylib_nuklear_hash().
+ */
+#define RAYLIB_NUKLEAR_HASH_SEED 14695981039346656037ULL
+
+/**
+ * Continue a 64-bit FNV-1a hash with the given memory.
+ *
+ * @internal
+ */
+static unsigned long long
+raylib_nuklear_hash(const void *data, size_t size, unsigned long long hash)
+{
+    const unsigned char* bytes = (const unsigned char*)data;
+    for (size_t i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/**
+ * Read 8 bytes as a little-endian number, so that hashes are the same on every platform.
+ *
+ * @internal
+ */
+static inline unsigned long long
+raylib_nuklear_read64(const unsigned char* bytes)
+{
+    return (unsigned long long)bytes[0] | ((unsigned long long)bytes[1] << 8) | ((unsigned long long)bytes[2] << 16) |
+        ((unsigned long long)bytes[3] << 24) | ((unsigned long long)bytes[4] << 32) | ((unsigned long long)bytes[5] << 40) |
+        ((unsigned long long)bytes[6] << 48) | ((unsigned long long)bytes[7] << 56);
+}
+
+/**
+ * Read 4 bytes as a little-endian number.
+ *
+ * @internal
+ */
+static inline unsigned long long
+raylib_nuklear_read32(const unsigned char* bytes)
+{
+    return (unsigned long long)bytes[0] | ((unsigned long long)bytes[1] << 8) | ((unsigned long long)bytes[2] << 16) |
+        ((unsigned long long)bytes[3] << 24);
+}
+
+/**
+ * Mix 8 bytes into a hash.
+ *
+ * @internal
+ */
+static inline unsigned long long
+raylib_nuklear_hash_mix(unsigned long long hash, unsigned long long value)
+{
+    hash = (hash ^ (value * 0x9E3779B97F4A7C15ULL)) * 0xBF58476D1CE4E5B9ULL;
+    return hash ^ (hash >> 31);
+}
+
+/**
+ * Hash a string a word at a time, for widget IDs.
+ *
+ * Strings of up to 16 bytes are read as two possibly overlapping words, and longer strings in two interleaved lanes of
+ * words, ending with the last 16 bytes. The hash only depends on the string's bytes, so it's the same across runs and
+ * platforms.
+ *
+ * @internal
+ */
+static unsigned long long
+raylib_nuklear_hash_string(const char* str, int len)
+{
+    const unsigned char* bytes = (const unsigned char*)str;
+    unsigned long long hash = RAYLIB_NUKLEAR_HASH_SEED ^ (unsigned long long)len;
+    if (len <= 16) {
+        unsigned long long a = 0;
+        unsigned long long b = 0;
+        if (len >= 8) {
+            a = raylib_nuklear_read64(bytes);
+            b = raylib_nuklear_read64(bytes + len - 8);
+        }
+        else if (len >= 4) {
+            a = raylib_nuklear_read32(bytes);
+            b = raylib_nuklear_read32(bytes + len - 4);
+        }
+        else if (len > 0) {
+            a = (unsigned long long)bytes[0] | ((unsigned long long)bytes[len / 2] << 8) | ((unsigned long long)bytes[len - 1] << 16);
+        }
+        return raylib_nuklear_hash_mix(hash ^ a, b);
+    }
+
+    unsigned long long other = hash ^ 0x94D049BB133111EBULL;
+    int i = 0;
+    for (; i + 16 < len; i += 16) {
+        hash = raylib_nuklear_hash_mix(hash, raylib_nuklear_read64(bytes + i));
+        other = raylib_nuklear_hash_mix(other, raylib_nuklear_read64(bytes + i + 8));
+    }
+    hash = raylib_nuklear_hash_mix(hash, raylib_nuklear_read64(bytes + len - 16));
+    other = raylib_nuklear_hash_mix(other, raylib_nuklear_read64(bytes + len - 8));
+    return raylib_nuklear_hash_mix(hash, other);
+}
+
+/**
+ * Find the hash of a long string in the memo, or hash it and remember it for the rest of the frame.
+ *
+ * The strings are compared with a copy, so a string that changed at the same address is hashed again.
+ *
+ * @internal
+ */
+static unsigned long long
+raylib_nuklear_hash_memo(NuklearHashMemo* memo, const char* str, int len)
+{
+    if (memo->entries == NULL) {
+        memo->entries = (NuklearHashMemoEntry*)MemAlloc(RAYLIB_NUKLEAR_HASH_MEMO_SIZE * sizeof(NuklearHashMemoEntry));
+        if (memo->entries == NULL) {
+            return raylib_nuklear_hash_string(str, len);
+        }
+        nk_zero(memo->entries, RAYLIB_NUKLEAR_HASH_MEMO_SIZE * sizeof(NuklearHashMemoEntry));
+    }
+
+    unsigned long long address = (unsigned long long)(size_t)str ^ ((unsigned long long)len << 48);
+    NuklearHashMemoEntry* entry = &memo->entries[((address * 0x9E3779B97F4A7C15ULL) >> 32) & (RAYLIB_NUKLEAR_HASH_MEMO_SIZE - 1)];
+    if (entry->frame == memo->frame && entry->str == str && entry->len == len) {
+        const unsigned char* copy = (const unsigned char*)memo->copies + entry->copy;
+        const unsigned char* bytes = (const unsigned char*)str;
+        int i = 0;
+        while (i + 8 <= len && raylib_nuklear_read64(copy + i) == raylib_nuklear_read64(bytes + i)) {
+            i += 8;
+        }
+        while (i < len && copy[i] == bytes[i]) {
+            i++;
+        }
+        if (i == len) {
+            memo->hits++;
+            return entry->hash;
+        }
+    }
+
+    // Replace the entry, reusing its copy when it's from this frame and long enough.
+    unsigned long long hash = raylib_nuklear_hash_string(str, len);
+    size_t copy = memo->copySize;
+    if (entry->frame == memo->frame && entry->len >= len) {
+        copy = entry->copy;
+    }
+    else if (memo->copySize + (size_t)len > RAYLIB_NUKLEAR_HASH_MEMO_COPY_LIMIT) {
+        return hash;
+    }
+    else if (memo->copySize + (size_t)len > memo->copyCapacity) {
+        size_t capacity = NK_MIN(NK_MAX(memo->copyCapacity * 2, memo->copySize + (size_t)len + 1024), (size_t)RAYLIB_NUKLEAR_HASH_MEMO_COPY_LIMIT);
+        char* copies = (char*)MemRealloc(memo->copies, (unsigned int)capacity);
+        if (copies == NULL) {
+            return hash;
+        }
+        memo->copies = copies;
+        memo->copyCapacity = capacity;
+    }
+    if (copy == memo->copySize) {
+        memo->copySize += (size_t)len;
+    }
+
+    nk_memcopy(memo->copies + copy, str, (nk_size)len);
+    entry->str = str;
+    entry->len = len;
+    entry->frame = memo->frame;
+    entry->copy = copy;
+    entry->hash = hash;
+    memo->misses++;
+    return hash;
+}
+
+/**
+ * Hash a widget ID, like nk_murmur_hash() but a word at a time, combined with the given seed.
+ *
+ * The string is hashed on its own and the seed mixed in afterwards, so IDs that share a string and differ in their
+ * seed, like the nodes of nk_raylib_tree_push_id(), reuse the string's hash from the memo.
+ *
+ * @param memo The hashes of this frame's long IDs, or NULL to always hash the string.
+ *
+ * @internal
+ */
+static nk_hash
+raylib_nuklear_hash_id(NuklearHashMemo* memo, const char* str, int len, nk_hash seed)
+{
+    unsigned long long hash = (memo != NULL && len >= RAYLIB_NUKLEAR_HASH_MEMO_MIN_LENGTH) ?
+        raylib_nuklear_hash_memo(memo, str, len) : raylib_nuklear_hash_string(str, len);
+
+    // Mix the seed in, and fold the hash to Nuklear's 32-bit hashes.
+    hash ^= (unsigned long long)seed * 0xD6E8FEB86659FD93ULL;
+    hash = (hash ^ (hash >> 29)) * 0x94D049BB133111EBULL;
+    return (nk_hash)(hash ^ (hash >> 32));
+}
+
+/**
+ * Unload the line-break cache of a context.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_unload_wrap_cache(NuklearUserData* userData)
+{
+    for (int i = 0; i < userData->wrap_text_count; i++) {
+        MemFree(userData->wrap_texts[i].lines);
+    }
+    MemFree(userData->wrap_texts);
+    MemFree(userData->wrap_slots);
+    userData->wrap_texts = NULL;
+    userData->wrap_text_count = userData->wrap_text_capacity = 0;
+    userData->wrap_slots = NULL;
+    userData->wrap_slot_count = 0;
+}
+
+/**
+ * Fill the hash table of the line-break cache again, growing it when it's getting full.
+ *
+ * @return False when the hash table couldn't be allocated.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_rehash_wrap_texts(NuklearUserData* userData)
+{
+    int slotCount = (userData->wrap_slot_count == 0) ? 32 : userData->wrap_slot_count;
+    while (slotCount < userData->wrap_text_count * 2) {
+        slotCount *= 2;
+    }
+    if (slotCount != userData->wrap_slot_count) {
+        int* slots = (int*)MemRealloc(userData->wrap_slots, (unsigned int)((size_t)slotCount * sizeof(int)));
+        if (slots == NULL) {
+            return false;
+        }
+        userData->wrap_slots = slots;
+        userData->wrap_slot_count = slotCount;
+    }
+
+    nk_memset(userData->wrap_slots, 0, (nk_size)userData->wrap_slot_count * sizeof(int));
+    unsigned int mask = (unsigned int)userData->wrap_slot_count - 1;
+    for (int i = 0; i < userData->wrap_text_count; i++) {
+        unsigned int slot = (unsigned int)userData->wrap_texts[i].hash & mask;
+        while (userData->wrap_slots[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        userData->wrap_slots[slot] = i + 1;
+    }
+    return true;
+}
+
+/**
+ * Get the line breaks of wrapped text from the context's line-break cache, measuring the text when it isn't cached.
+ *
+ * Texts that weren't laid out in the current or the previous Nuklear frame are evicted, the same way that nk_clear()
+ * frees the windows that weren't used.
+ *
+ * @return The cached text, or NULL when it couldn't be allocated.
+ *
+ * @internal
+ */
+static NuklearWrapText*
+raylib_nuklear_get_wrap_text(struct nk_context* ctx, const struct nk_user_font* font, const char* text, int len, float width)
+{
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+    if (userData->wrap_seq != ctx->seq) {
+        int count = userData->wrap_text_count;
+        for (int i = userData->wrap_text_count - 1; i >= 0; i--) {
+            if (ctx->seq - userData->wrap_texts[i].seq > 1) {
+                MemFree(userData->wrap_texts[i].lines);
+                userData->wrap_texts[i] = userData->wrap_texts[--userData->wrap_text_count];
+            }
+        }
+        userData->wrap_seq = ctx->seq;
+
+        // Evicting moves texts around, so their hash table is filled again.
+        if (userData->wrap_text_count != count && !raylib_nuklear_rehash_wrap_texts(userData)) {
+            raylib_nuklear_unload_wrap_cache(userData);
+        }
+    }
+
+    unsigned long long hash = raylib_nuklear_hash(text, (size_t)len, RAYLIB_NUKLEAR_HASH_SEED);
+    if (userData->wrap_slot_count > 0) {
+        unsigned int mask = (unsigned int)userData->wrap_slot_count - 1;
+        for (unsigned int slot = (unsigned int)hash & mask; userData->wrap_slots[slot] != 0; slot = (slot + 1) & mask) {
+            NuklearWrapText* wrap = &userData->wrap_texts[userData->wrap_slots[slot] - 1];
+            if (wrap->hash == hash && wrap->length == len && wrap->font == font && wrap->fontHeight == font->height &&
+                    wrap->width == width && wrap->scale == userData->scaling) {
+                wrap->seq = ctx->seq;
+                return wrap;
+            }
+        }
+    }
+
+    if (userData->wrap_text_count == userData->wrap_text_capacity) {
+        int capacity = (userData->wrap_text_capacity == 0) ? 16 : userData->wrap_text_capacity * 2;
+        NuklearWrapText* texts = (NuklearWrapText*)MemRealloc(userData->wrap_texts, (unsigned int)((size_t)capacity * sizeof(NuklearWrapText)));
+        if (texts == NULL) {
+            return NULL;
+        }
+        userData->wrap_texts = texts;
+        userData->wrap_text_capacity = capacity;
+    }
+
+    // Break the text into lines the same way as nk_widget_text_wrap().
+    NK_INTERN nk_rune separator[] = {' '};
+    NuklearWrapLine* lines = NULL;
+    int lineCount = 0;
+    int lineCapacity = 0;
+    int done = 0;
+    int glyphs = 0;
+    float lineWidth = 0;
+    int fitting = nk_text_clamp(font, text, len, width, &glyphs, &lineWidth, separator, NK_LEN(separator));
+    while (done < len && fitting) {
+        if (lineCount == lineCapacity) {
+            lineCapacity = (lineCapacity == 0) ? 8 : lineCapacity * 2;
+            NuklearWrapLine* grown = (NuklearWrapLine*)MemRealloc(lines, (unsigned int)((size_t)lineCapacity * sizeof(NuklearWrapLine)));
+            if (grown == NULL) {
+                MemFree(lines);
+                return NULL;
+            }
+            lines = grown;
+        }
+        lines[lineCount].length = fitting;
+        lines[lineCount].width = font->width(font->userdata, font->height, &text[done], fitting);
+        lineCount++;
+        done += fitting;
+        fitting = nk_text_clamp(font, &text[done], len - done, width, &glyphs, &lineWidth, separator, NK_LEN(separator));
+    }
+
+    NuklearWrapText* wrap = &userData->wrap_texts[userData->wrap_text_count++];
+    wrap->hash = hash;
+    wrap->length = len;
+    wrap->font = font;
+    wrap->fontHeight = font->height;
+    wrap->width = width;
+    wrap->scale = userData->scaling;
+    wrap->seq = ctx->seq;
+    wrap->lines = lines;
+    wrap->lineCount = lineCount;
+
+    if (userData->wrap_text_count * 2 > userData->wrap_slot_count) {
+        if (!raylib_nuklear_rehash_wrap_texts(userData)) {
+            MemFree(lines);
+            userData->wrap_text_count--;
+            return NULL;
+        }
+    }
+    else {
+        unsigned int mask = (unsigned int)userData->wrap_slot_count - 1;
+        unsigned int slot = (unsigned int)hash & mask;
+        while (userData->wrap_slots[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        userData->wrap_slots[slot] = userData->wrap_text_count;
+    }
+    return wrap;
+}
+
+/**
+ * Push a line of wrapped text like nk_draw_text(), using its cached width instead of measuring it.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_draw_wrap_line(struct nk_command_buffer *b, struct nk_rect r, const char *string, const NuklearWrapLine* line,
+    const struct nk_user_font *font, struct nk_color bg, struct nk_color fg)
+{
+    // Lines that don't fit are clamped by nk_draw_text().
+    if (line->width > r.w) {
+        nk_draw_text(b, r, string, line->length, font, bg, fg);
+        return;
+    }
+
+    if (!line->length || (bg.a == 0 && fg.a == 0)) return;
+    if (b->use_clipping) {
+        const struct nk_rect *c = &b->clip;
+        if (c->w == 0 || c->h == 0 || !NK_INTERSECT(r.x, r.y, r.w, r.h, c->x, c->y, c->w, c->h))
+            return;
+    }
+
+    struct nk_command_text* cmd = (struct nk_command_text*)nk_command_buffer_push(b, NK_COMMAND_TEXT, sizeof(*cmd) + (nk_size)(line->length + 1));
+    if (!cmd) return;
+    cmd->x = (short)r.x;
+    cmd->y = (short)r.y;
+    cmd->w = (unsigned short)r.w;
+    cmd->h = (unsigned short)r.h;
+    cmd->background = bg;
+    cmd->foreground = fg;
+    cmd->font = font;
+    cmd->length = line->length;
+    cmd->height = font->height;
+    nk_memcopy(cmd->string, string, (nk_size)line->length);
+    cmd->string[line->length] = '\0';
+}
+
+/**
+ * Draw wrapped text like nk_text_wrap_colored(), with its line breaks from the context's line-break cache.
+ *
+ * nk_text_wrap() measures every prefix of every line of wrapped text each frame, which is slow for long text. This
+ * lays the text out the same way, but keeps the line breaks and widths of the text between frames. Unchanged text is
+ * hashed and drawn without measuring it again, and lines below the clip rectangle are skipped. The cache is keyed by
+ * the text's contents, so the string can change or move freely. Texts that weren't drawn in the last frame are
+ * evicted.
+ *
+ * @param ctx The Nuklear context.
+ * @param str The text to draw, which doesn't need to be null terminated.
+ * @param len The length of the text, in bytes.
+ * @param color The color of the text.
+ *
+ * @see nk_raylib_label_wrap()
+ */
+NK_API void
+nk_raylib_text_wrap_colored(struct nk_context *ctx, const char *str, int len, struct nk_color color)
+{
+    NK_ASSERT(ctx);
+    NK_ASSERT(ctx->current);
+    NK_ASSERT(ctx->current->layout);
+    if (!ctx || !ctx->current || !ctx->current->layout) return;
+
+    struct nk_window* win = ctx->current;
+    const struct nk_style* style = &ctx->style;
+    const struct nk_user_font* font = style->font;
+    struct nk_rect bounds;
+    struct nk_text text;
+    nk_panel_alloc_space(&bounds, ctx);
+    text.padding = style->text.padding;
+    text.background = style->window.background;
+    text.text = nk_rgb_factor(color, style->text.color_factor);
+
+    NuklearWrapText* wrap = NULL;
+    if (ctx->userdata.ptr != NULL && ((NuklearUserData*)ctx->userdata.ptr)->arena == NULL && str != NULL && len > 0) {
+        float width = NK_MAX(bounds.w, 2 * text.padding.x) - 2 * text.padding.x;
+        wrap = raylib_nuklear_get_wrap_text(ctx, font, str, len, width);
+    }
+    if (wrap == NULL) {
+        nk_widget_text_wrap(&win->buffer, bounds, str, len, &text, font);
+        return;
+    }
+
+    // The bounds and line rectangles match nk_widget_text_wrap().
+    bounds.w = NK_MAX(bounds.w, 2 * text.padding.x);
+    bounds.h = NK_MAX(bounds.h, 2 * text.padding.y);
+    bounds.h = bounds.h - 2 * text.padding.y;
+    struct nk_rect line;
+    line.x = bounds.x + text.padding.x;
+    line.y = bounds.y + text.padding.y;
+    line.w = bounds.w - 2 * text.padding.x;
+    line.h = 2 * text.padding.y + font->height;
+
+    // Each line is drawn like nk_widget_text() draws NK_TEXT_LEFT text without padding.
+    const struct nk_rect* clip = &win->buffer.clip;
+    int done = 0;
+    for (int i = 0; i < wrap->lineCount; i++) {
+        if (line.y + line.h >= (bounds.y + bounds.h)) break;
+        struct nk_rect label;
+        label.x = line.x;
+        label.w = NK_MAX(0, line.w);
+        label.y = line.y + line.h / 2.0f - font->height / 2.0f;
+        label.h = NK_MAX(line.h / 2.0f, line.h - (line.h / 2.0f + font->height / 2.0f));
+        if (win->buffer.use_clipping && label.y > clip->y + clip->h) break;
+        raylib_nuklear_draw_wrap_line(&win->buffer, label, &str[done], &wrap->lines[i], font, text.background, text.text);
+        done += wrap->lines[i].length;
+        line.y += font->height + 2 * text.padding.y;
+    }
+}
+
+/**
+ * Draw wrapped text like nk_text_wrap(), with its line breaks from the context's line-break cache.
+ *
+ * @see nk_raylib_text_wrap_colored()
+ */
+NK_API void
+nk_raylib_text_wrap(struct nk_context *ctx, const char *str, int len)
+{
+    NK_ASSERT(ctx);
+    if (!ctx) return;
+    nk_raylib_text_wrap_colored(ctx, str, len, ctx->style.text.color);
+}
+
+/**
+ * Draw a wrapped label like nk_label_wrap(), with its line breaks from the context's line-break cache.
+ *
+ * @code
+ * nk_layout_row_dynamic(ctx, 200, 1);
+ * nk_raylib_label_wrap(ctx, helpText);
+ * @endcode
+ *
+ * @see nk_raylib_text_wrap_colored()
+ */
+NK_API void
+nk_raylib_label_wrap(struct nk_context *ctx, const char *str)
+{
+    nk_raylib_text_wrap(ctx, str, nk_strlen(str));
+}
+
+/**
+ * Draw a colored wrapped label like nk_label_colored_wrap(), with its line breaks from the context's line-break cache.
+ *
+ * @see nk_raylib_text_wrap_colored()
+ */
+NK_API void
+nk_raylib_label_colored_wrap(struct nk_context *ctx, const char *str, struct nk_color color)
+{
+    nk_raylib_text_wrap_colored(ctx, str, nk_strlen(str), color);
+}
+
+/**
+ * Initialize a text edit like nk_textedit_init(), allocating its text through the context's allocator.
+ *
+ * Its memory is reported as NUKLEAR_MEMORY_TEXT_EDIT by GetNuklearMemoryStats(). Free it with nk_textedit_free()
+ * before unloading the context.
+ *
+ * @param ctx The nuklear context.
+ * @param box The text edit to initialize.
+ * @param size The initial size of its text buffer, in bytes.
+ */
+NK_API void
+nk_raylib_textedit_init(struct nk_context *ctx, struct nk_text_edit *box, nk_size size)
+{
+    if (box == NULL) {
+        return;
+    }
+
+    struct nk_allocator alloc;
+    if (ctx != NULL && ctx->userdata.ptr != NULL) {
+        alloc = raylib_nuklear_allocator(&((NuklearUserData*)ctx->userdata.ptr)->memory, NUKLEAR_MEMORY_TEXT_EDIT);
+    }
+    else {
+        alloc.userdata = nk_handle_ptr(0);
+        alloc.alloc = nk_raylib_malloc;
+        alloc.free = nk_raylib_mfree;
+    }
+    nk_textedit_init(box, &alloc, size);
+}
+
+/**
+ * Get the state with the given index from a NuklearStateIndex.
+ *
+ * @internal
+ */
+static NuklearWidgetState*
+raylib_nuklear_state_at(NuklearStateIndex* index, int state)
+{
+    return &index->pages[state / RAYLIB_NUKLEAR_STATE_PAGE_SIZE][state % RAYLIB_NUKLEAR_STATE_PAGE_SIZE];
+}
+
+/**
+ * Get the first slot to probe for the given widget of the given window.
+ *
+ * @internal
+ */
+static int
+raylib_nuklear_state_slot(const NuklearStateIndex* index, nk_hash window, nk_hash id)
+{
+    nk_uint hash = (id ^ (window * 0x9E3779B1u)) * 0x85EBCA6Bu;
+    return (int)((hash ^ (hash >> 16)) & (nk_uint)(index->slotCount - 1));
+}
+
+/**
+ * Find the state of the given widget of the given window in the hash index.
+ *
+ * @return The state, or NULL when the widget has none.
+ *
+ * @internal
+ */
+static NuklearWidgetState*
+raylib_nuklear_find_state(NuklearStateIndex* index, nk_hash window, nk_hash id)
+{
+    if (index->slotCount == 0) {
+        return NULL;
+    }
+
+    int mask = index->slotCount - 1;
+    for (int slot = raylib_nuklear_state_slot(index, window, id); index->slots[slot] != 0; slot = (slot + 1) & mask) {
+        NuklearWidgetState* state = raylib_nuklear_state_at(index, index->slots[slot] - 1);
+        if (state->id == id && state->window == window) {
+            return state;
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Rebuild the slots of the hash index with the given amount of slots, for all of its states.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_rehash_states(NuklearStateIndex* index, int slotCount)
+{
+    if (slotCount != index->slotCount) {
+        int* slots = (int*)MemAlloc((unsigned int)((size_t)slotCount * sizeof(int)));
+        if (slots == NULL) {
+            return false;
+        }
+        MemFree(index->slots);
+        index->slots = slots;
+        index->slotCount = slotCount;
+    }
+
+    int* slots = index->slots;
+    nk_memset(slots, 0, (nk_size)slotCount * sizeof(int));
+    int mask = slotCount - 1;
+    for (int i = 0; i < index->count; i++) {
+        const NuklearWidgetState* state = raylib_nuklear_state_at(index, i);
+        int slot = raylib_nuklear_state_slot(index, state->window, state->id);
+        while (slots[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        slots[slot] = i + 1;
+    }
+    return true;
+}
+
+/**
+ * Add a state for the given widget of the given window, which has none yet, to the hash index.
+ *
+ * @return The new state with its values set to 0, or NULL when out of memory.
+ *
+ * @internal
+ */
+static NuklearWidgetState*
+raylib_nuklear_add_state(NuklearStateIndex* index, nk_hash window, nk_hash id)
+{
+    // Remember the windows with states, to drop their states along with them.
+    bool known = false;
+    for (int i = 0; i < index->windowCount && !known; i++) {
+        known = index->windows[i] == window;
+    }
+    if (!known) {
+        if (index->windowCount == index->windowCapacity) {
+            int capacity = (index->windowCapacity > 0) ? index->windowCapacity * 2 : 8;
+            nk_hash* windows = (nk_hash*)MemRealloc(index->windows, (unsigned int)((size_t)capacity * sizeof(nk_hash)));
+            if (windows == NULL) {
+                return NULL;
+            }
+            index->windows = windows;
+            index->windowCapacity = capacity;
+        }
+        index->windows[index->windowCount++] = window;
+    }
+
+    // Keep the slots at most half full.
+    if ((index->count + 1) * 2 > index->slotCount && !raylib_nuklear_rehash_states(index, (index->slotCount > 0) ? index->slotCount * 2 : 256)) {
+        return NULL;
+    }
+
+    if (index->count == index->pageCount * RAYLIB_NUKLEAR_STATE_PAGE_SIZE) {
+        NuklearWidgetState** pages = (NuklearWidgetState**)MemRealloc(index->pages, (unsigned int)((size_t)(index->pageCount + 1) * sizeof(NuklearWidgetState*)));
+        if (pages == NULL) {
+            return NULL;
+        }
+        index->pages = pages;
+        index->pages[index->pageCount] = (NuklearWidgetState*)MemAlloc(RAYLIB_NUKLEAR_STATE_PAGE_SIZE * sizeof(NuklearWidgetState));
+        if (index->pages[index->pageCount] == NULL) {
+            return NULL;
+        }
+        index->pageCount++;
+    }
+
+    NuklearWidgetState* state = raylib_nuklear_state_at(index, index->count);
+    state->window = window;
+    state->id = id;
+    state->values[0] = 0;
+    state->values[1] = 0;
+
+    int mask = index->slotCount - 1;
+    int slot = raylib_nuklear_state_slot(index, window, id);
+    while (index->slots[slot] != 0) {
+        slot = (slot + 1) & mask;
+    }
+    index->slots[slot] = ++index->count;
+    return state;
+}
+
+/**
+ * Drop the states of the windows that nk_clear() freed, like Nuklear frees the value tables of its windows.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_collect_states(struct nk_context* ctx, NuklearStateIndex* index)
+{
+    // Find the windows that are gone. There are only a few windows, so their list is walked for each.
+    int alive = 0;
+    for (int i = 0; i < index->windowCount; i++) {
+        struct nk_window* win = ctx->begin;
+        while (win != NULL && win->name != index->windows[i]) {
+            win = win->next;
+        }
+        if (win != NULL) {
+            index->windows[alive++] = index->windows[i];
+        }
+    }
+    if (alive == index->windowCount) {
+        return;
+    }
+    index->windowCount = alive;
+
+    // Compact the states of the remaining windows, and index them again.
+    int count = 0;
+    for (int i = 0; i < index->count; i++) {
+        const NuklearWidgetState* state = raylib_nuklear_state_at(index, i);
+        bool keep = false;
+        for (int w = 0; w < index->windowCount && !keep; w++) {
+            keep = index->windows[w] == state->window;
+        }
+        if (keep) {
+            *raylib_nuklear_state_at(index, count++) = *state;
+        }
+    }
+    index->count = count;
+    if (index->slotCount > 0) {
+        raylib_nuklear_rehash_states(index, index->slotCount);
+    }
+}
+
+/**
+ * Unload the widget states of a context.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_unload_states(NuklearStateIndex* index)
+{
+    for (int i = 0; i < index->pageCount; i++) {
+        MemFree(index->pages[i]);
+    }
+    MemFree(index->pages);
+    MemFree(index->slots);
+    MemFree(index->windows);
+    nk_zero(index, sizeof(NuklearStateIndex));
+}
+
+/**
+ * Get the state of the widget with the given ID in the current window, adding it when it has none yet.
+ *
+ * @param added Set to whether the state was just added.
+ *
+ * @return The state, or NULL when there's no current window or no memory for it.
+ *
+ * @internal
+ */
+static NuklearWidgetState*
+raylib_nuklear_get_state(struct nk_context* ctx, const char* str, int len, nk_hash seed, bool* added)
+{
+    *added = false;
+    if (ctx == NULL || ctx->current == NULL || ctx->current->layout == NULL || ctx->userdata.ptr == NULL) {
+        return NULL;
+    }
+
+    // Contexts in fixed memory hash without the memo, as it allocates.
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+    nk_hash id = raylib_nuklear_hash_id((userData->arena == NULL) ? &userData->hash_memo : NULL, str, len, seed);
+
+    // Popups, combos and contextual menus are windows without a name that aren't in the context's window list, so the
+    // states of their widgets are kept with the window that opened them, told apart by the popup's name.
+    const struct nk_window* win = ctx->current;
+    while (win->parent != NULL) {
+        unsigned long long hash = raylib_nuklear_hash_mix(id, win->parent->popup.name);
+        id = (nk_hash)(hash ^ (hash >> 32));
+        win = win->parent;
+    }
+
+    NuklearStateIndex* index = &userData->states;
+    NuklearWidgetState* state = raylib_nuklear_find_state(index, win->name, id);
+    if (state == NULL) {
+        state = raylib_nuklear_add_state(index, win->name, id);
+        *added = state != NULL;
+    }
+    return state;
+}
+
+/**
+ * Push a tree node like nk_tree_push_hashed(), looking its state up in a hash index rather than the window's tables.
+ *
+ * Nuklear searches all of a window's value tables for each tree node, which gets slow for trees that have persisted
+ * the states of many nodes. The states are dropped along with their window, in UpdateNuklear() and DrawNuklear().
+ *
+ * The states aren't shared with Nuklear's: they're found by raylib_nuklear_hash_id() rather than nk_murmur_hash(), so
+ * a node that's pushed with both nk_tree_push() and nk_raylib_tree_push() keeps a separate state for each.
+ *
+ * @param ctx The nuklear context.
+ * @param type Whether the node is a tab or a node.
+ * @param title The label of the node.
+ * @param initial_state Whether the node starts out collapsed or expanded.
+ * @param hash The data to identify the node with, or NULL to use its title.
+ * @param len The length of hash.
+ * @param seed Identifies nodes that share their hash, like the line of code they're pushed on.
+ *
+ * @return True when the node is expanded, after which it needs closing with nk_tree_pop().
+ *
+ * @code
+ * if (nk_raylib_tree_push(ctx, NK_TREE_NODE, "Node", NK_MINIMIZED)) {
+ *     nk_tree_pop(ctx);
+ * }
+ * @endcode
+ */
+NK_API nk_bool
+nk_raylib_tree_push_hashed(struct nk_context *ctx, enum nk_tree_type type, const char *title, enum nk_collapse_states initial_state, const char *hash, int len, int seed)
+{
+    if (title == NULL) {
+        return nk_false;
+    }
+    if (hash == NULL) {
+        hash = title;
+        len = (int)nk_strlen(title);
+    }
+
+    bool added;
+    NuklearWidgetState* state = raylib_nuklear_get_state(ctx, hash, len, (nk_hash)seed, &added);
+    if (state == NULL) {
+        return (ctx != NULL && ctx->current != NULL) ? nk_tree_push_hashed(ctx, type, title, initial_state, hash, len, seed) : nk_false;
+    }
+    if (added) {
+        state->values[0] = (nk_uint)initial_state;
+    }
+    return nk_tree_state_push(ctx, type, title, (enum nk_collapse_states*)&state->values[0]);
+}
+
+/**
+ * Begin a group like nk_group_begin_titled(), looking its scroll offsets up in a hash index rather than the window's tables.
+ *
+ * Like with nk_raylib_tree_push_hashed(), the scroll offsets are kept apart from those of nk_group_begin_titled().
+ *
+ * @param ctx The nuklear context.
+ * @param name The unique name of the group.
+ * @param title The title of the group, shown with NK_WINDOW_TITLE.
+ * @param flags The nk_panel_flags of the group.
+ *
+ * @return True when the group is visible, after which it needs closing with nk_group_end().
+ *
+ * @see nk_raylib_tree_push_hashed()
+ */
+NK_API nk_bool
+nk_raylib_group_begin_titled(struct nk_context *ctx, const char *name, const char *title, nk_flags flags)
+{
+    if (name == NULL) {
+        return nk_false;
+    }
+
+    bool added;
+    NuklearWidgetState* state = raylib_nuklear_get_state(ctx, name, (int)nk_strlen(name), NK_PANEL_GROUP, &added);
+    if (state == NULL) {
+        return (ctx != NULL && ctx->current != NULL) ? nk_group_begin_titled(ctx, name, title, flags) : nk_false;
+    }
+    return nk_group_scrolled_offset_begin(ctx, &state->values[0], &state->values[1], title, flags);
+}
+
+/**
+ * Begin a group like nk_group_begin(), looking its scroll offsets up in a hash index rather than the window's tables.
+ *
+ * @param ctx The nuklear context.
+ * @param title The unique title of the group.
+ * @param flags The nk_panel_flags of the group.
+ *
+ * @return True when the group is visible, after which it needs closing with nk_group_end().
+ *
+ * @see nk_raylib_group_begin_titled()
+ */
+NK_API nk_bool
+nk_raylib_group_begin(struct nk_context *ctx, const char *title, nk_flags flags)
+{
+    return nk_raylib_group_begin_titled(ctx, title, title, flags);
+}
+
+/**
+ * Checks if Nuklear was loaded successfully.
+ *
+ * @param ctx The Nuklear context.
+ * @return True when the Nuklear context was loaded successfully, false otherwise.
+ */
+NK_API bool IsNuklearValid(struct nk_context* ctx) {
+    return ctx != NULL;
+}
+
+/**
+ * A font's atlas image and glyph table, from which the font can be loaded without rasterizing it again.
+ *
+ * @internal
+ */
+typedef struct NuklearFontBake {
+    int size;           // The size of the font, or 0 when the bake is unused.
+    Image atlas;        // The font's atlas, as gray and alpha.
+    GlyphInfo* glyphs;  // The font's glyphs, without their images.
+    Rectangle* recs;    // Where the glyphs are in the atlas.
+    int glyphCount;     // The amount of glyphs.
+} NuklearFontBake;
+
+/**
+ * The padding around the glyphs of TTF fonts that raylib bakes, FONT_TTF_DEFAULT_CHARS_PADDING.
+ *
+ * @internal
+ */
+#define RAYLIB_NUKLEAR_FONT_GLYPH_PADDING 4
+
+/**
+ * Bake a font file at the given size, the same way LoadFontFromMemory() does, keeping its atlas image.
+ *
+ * @param codepoints The codepoints to bake, or NULL for codepointCount codepoints from 32 up.
+ * @param codepointCount The amount of codepoints, or 0 for the 95 printable ASCII characters.
+ *
+ * @return True on success.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_bake_font(const unsigned char* fileData, int dataSize, int size, int* codepoints, int codepointCount, NuklearFontBake* bake)
+{
+    if (codepointCount <= 0) {
+        codepointCount = 95;
+    }
+#if RAYLIB_VERSION_MAJOR >= 6
+    int glyphCount = 0;
+    GlyphInfo* glyphs = LoadFontData(fileData, dataSize, size, codepoints, codepointCount, FONT_DEFAULT, &glyphCount);
+#else
+    int glyphCount = codepointCount;
+    GlyphInfo* glyphs = LoadFontData(fileData, dataSize, size, codepoints, codepointCount, FONT_DEFAULT);
+#endif
+    if (glyphs == NULL) {
+        return false;
+    }
+    bake->size = size;
+    bake->glyphCount = glyphCount;
+    bake->recs = NULL;
+    bake->atlas = GenImageFontAtlas(glyphs, &bake->recs, glyphCount, size, RAYLIB_NUKLEAR_FONT_GLYPH_PADDING, 0);
+    for (int i = 0; i < glyphCount; i++) {
+        UnloadImage(glyphs[i].image);
+        glyphs[i].image = CLITERAL(Image) {0};
+    }
+    bake->glyphs = glyphs;
+    return bake->atlas.data != NULL && bake->recs != NULL;
+}
+
+/**
+ * Load a font from a bake, without rasterizing it again.
+ *
+ * @internal
+ */
+static Font
+raylib_nuklear_load_font_bake(const NuklearFontBake* bake)
+{
+    Font font = {0};
+    font.baseSize = bake->size;
+    font.glyphCount = bake->glyphCount;
+    font.glyphPadding = RAYLIB_NUKLEAR_FONT_GLYPH_PADDING;
+    font.glyphs = (GlyphInfo*)MemAlloc((unsigned int)((size_t)bake->glyphCount * sizeof(GlyphInfo)));
+    font.recs = (Rectangle*)MemAlloc((unsigned int)((size_t)bake->glyphCount * sizeof(Rectangle)));
+    if (font.glyphs == NULL || font.recs == NULL) {
+        TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate the font");
+        MemFree(font.glyphs);
+        MemFree(font.recs);
+        return CLITERAL(Font) {0};
+    }
+    nk_memcopy(font.glyphs, bake->glyphs, (nk_size)bake->glyphCount * sizeof(GlyphInfo));
+    nk_memcopy(font.recs, bake->recs, (nk_size)bake->glyphCount * sizeof(Rectangle));
+
+    // Like LoadFontFromMemory(), give each glyph its image from the atlas, for ImageDrawText().
+    for (int i = 0; i < font.glyphCount; i++) {
+        font.glyphs[i].image = ImageFromImage(bake->atlas, font.recs[i]);
+    }
+    font.texture = LoadTextureFromImage(bake->atlas);
+    return font;
+}
+
+/**
+ * Unload the atlas image and glyph table of a bake.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_unload_font_bake(NuklearFontBake* bake)
+{
+    UnloadImage(bake->atlas);
+    MemFree(bake->recs);
+    UnloadFontData(bake->glyphs, bake->glyphCount);
+    *bake = CLITERAL(NuklearFontBake) {0};
+}
+
+#ifdef RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT
+#ifndef RAYLIB_NUKLEAR_DEFAULT_FONT_GLYPHS
+/**
+ * The amount of glyphs to load for the default font.
+ */
+#define RAYLIB_NUKLEAR_DEFAULT_FONT_GLYPHS 95
+#endif
+
+#ifndef RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES
+/**
+ * The amount of sizes of the default font that LoadFontFromNuklear() keeps baked, so that loading them again doesn't
+ * rasterize the font. 0 disables the cache.
+ */
+#define RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES 4
+#endif
+
+#if RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES > 0
+/**
+ * The sizes of the default font that were baked, kept until UnloadNuklearDefaultFontCache().
+ *
+ * @internal
+ */
+static NuklearFontBake raylib_nuklear_default_font_bakes[RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES];
+
+/**
+ * The next entry of raylib_nuklear_default_font_bakes to replace when it's full.
+ *
+ * @internal
+ */
+static int raylib_nuklear_default_font_next_bake = 0;
+#endif
+
+#if !defined(RAYLIB_NUKLEAR_DEFAULT_FONT_TTF) || !defined(RAYLIB_NUKLEAR_DEFAULT_FONT_TTF_SIZE)
+/**
+ * The default font file, decoded from Nuklear's compressed base85 data the first time it's needed, and kept until
+ * UnloadNuklearDefaultFontCache().
+ *
+ * @internal
+ */
+static unsigned char* raylib_nuklear_default_font_ttf = NULL;
+
+/**
+ * The size of raylib_nuklear_default_font_ttf.
+ *
+ * @internal
+ */
+static unsigned int raylib_nuklear_default_font_ttf_size = 0;
+#endif
+
+/**
+ * Get the default font file, decoding it the first time.
+ *
+ * Define RAYLIB_NUKLEAR_DEFAULT_FONT_TTF and RAYLIB_NUKLEAR_DEFAULT_FONT_TTF_SIZE to the data and size of a font file to
+ * skip decoding, like the one from ExportFontFromNuklearAsCode().
+ *
+ * @return The font file, or NULL on error.
+ *
+ * @internal
+ */
+static const unsigned char*
+raylib_nuklear_get_default_font_ttf(unsigned int* size)
+{
+#if defined(RAYLIB_NUKLEAR_DEFAULT_FONT_TTF) && defined(RAYLIB_NUKLEAR_DEFAULT_FONT_TTF_SIZE)
+    *size = (unsigned int)(RAYLIB_NUKLEAR_DEFAULT_FONT_TTF_SIZE);
+    return (const unsigned char*)(RAYLIB_NUKLEAR_DEFAULT_FONT_TTF);
+#else
+    if (raylib_nuklear_default_font_ttf == NULL) {
+        // Decode base85 -> compressed binary -> raw TTF
+        int compressed_size = (((int)nk_strlen(nk_proggy_clean_ttf_compressed_data_base85) + 4) / 5) * 4;
+        unsigned char *compressed_data = (unsigned char*)MemAlloc((unsigned int)compressed_size);
+        if (compressed_data == NULL) {
+            TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate the default font data");
+            return NULL;
+        }
+        nk_decode_85(compressed_data, (const unsigned char*)nk_proggy_clean_ttf_compressed_data_base85);
+
+        unsigned int ttf_size = nk_decompress_length(compressed_data);
+        unsigned char *ttf_data = (unsigned char*)MemAlloc(ttf_size);
+        if (ttf_data == NULL) {
+            TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate the default font data");
+            MemFree(compressed_data);
+            return NULL;
+        }
+        nk_decompress(ttf_data, compressed_data, (unsigned int)compressed_size);
+        MemFree(compressed_data);
+        raylib_nuklear_default_font_ttf = ttf_data;
+        raylib_nuklear_default_font_ttf_size = ttf_size;
+    }
+
+    *size = raylib_nuklear_default_font_ttf_size;
+    return raylib_nuklear_default_font_ttf;
+#endif
+}
+
+/**
+ * Bake the default font at the given size.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_bake_default_font(int size, NuklearFontBake* bake)
+{
+    unsigned int ttf_size = 0;
+    const unsigned char* ttf_data = raylib_nuklear_get_default_font_ttf(&ttf_size);
+    if (ttf_data == NULL) {
+        return false;
+    }
+    return raylib_nuklear_bake_font(ttf_data, (int)ttf_size, size, NULL, RAYLIB_NUKLEAR_DEFAULT_FONT_GLYPHS, bake);
+}
+#endif  // RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT
+
+/**
+ * Load the default Nuklear font. Requires `RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT` to be defined.
+ *
+ * The font file is decoded once, and the last RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES sizes that were loaded stay
+ * baked, so loading them again only uploads their atlas. Both are kept until UnloadNuklearDefaultFontCache().
+ *
+ * @param size The size of the font to load (optional). Provide 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ *
+ * @return The loaded font, or an empty font on error.
+ *
+ * @code
+ * #define RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT
+ * #include "raylib-nuklear.h"
+ * Font font = LoadFontFromNuklear(0);
+ * @endcode
+ */
+NK_API Font LoadFontFromNuklear(int size) {
+#ifndef RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT
+    (void)size;
+    TraceLog(LOG_ERROR, "NUKLEAR: RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT must be defined to use LoadFontFromNuklear()");
+    return CLITERAL(Font) {0};
+#else
+    if (size <= 0) {
+        size = RAYLIB_NUKLEAR_DEFAULT_FONTSIZE;
+    }
+
+#if RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES > 0
+    for (int i = 0; i < RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES; i++) {
+        if (raylib_nuklear_default_font_bakes[i].size == size) {
+            return raylib_nuklear_load_font_bake(&raylib_nuklear_default_font_bakes[i]);
+        }
+    }
+
+    // Replace the oldest size when the cache is full.
+    NuklearFontBake* bake = &raylib_nuklear_default_font_bakes[raylib_nuklear_default_font_next_bake];
+    raylib_nuklear_default_font_next_bake = (raylib_nuklear_default_font_next_bake + 1) % RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES;
+    if (bake->size != 0) {
+        raylib_nuklear_unload_font_bake(bake);
+    }
+    if (!raylib_nuklear_bake_default_font(size, bake)) {
+        TraceLog(LOG_WARNING, "NUKLEAR: Failed to bake the default font");
+        raylib_nuklear_unload_font_bake(bake);
+        return CLITERAL(Font) {0};
+    }
+    return raylib_nuklear_load_font_bake(bake);
+#else
+    NuklearFontBake bake = {0};
+    Font font = {0};
+    if (raylib_nuklear_bake_default_font(size, &bake)) {
+        font = raylib_nuklear_load_font_bake(&bake);
+    }
+    raylib_nuklear_unload_font_bake(&bake);
+    return font;
+#endif
+#endif
+}
+
+/**
+ * Export the default Nuklear font file as code, with ExportDataAsCode(). Requires
+ * `RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT` to be defined.
+ *
+ * Run it once at build time, and define RAYLIB_NUKLEAR_DEFAULT_FONT_TTF and RAYLIB_NUKLEAR_DEFAULT_FONT_TTF_SIZE to the
+ * exported data, so that the font ships as raw bytes instead of being decoded at runtime.
+ *
+ * @param fileName The header file to export to.
+ *
+ * @return True on success.
+ *
+ * @code
+ * // ExportFontFromNuklearAsCode("nuklear_font.h") exports NUKLEAR_FONT_DATA and NUKLEAR_FONT_DATA_SIZE.
+ * #include "nuklear_font.h"
+ * #define RAYLIB_NUKLEAR_DEFAULT_FONT_TTF NUKLEAR_FONT_DATA
+ * #define RAYLIB_NUKLEAR_DEFAULT_FONT_TTF_SIZE NUKLEAR_FONT_DATA_SIZE
+ * #define RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT
+ * #include "raylib-nuklear.h"
+ * @endcode
+ */
+NK_API bool ExportFontFromNuklearAsCode(const char* fileName) {
+#ifndef RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT
+    (void)fileName;
+    TraceLog(LOG_ERROR, "NUKLEAR: RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT must be defined to use ExportFontFromNuklearAsCode()");
+    return false;
+#else
+    unsigned int ttf_size = 0;
+    const unsigned char* ttf_data = raylib_nuklear_get_default_font_ttf(&ttf_size);
+    if (ttf_data == NULL) {
+        return false;
+    }
+    return ExportDataAsCode(ttf_data, (int)ttf_size, fileName);
+#endif
+}
+
+/**
+ * Unload the decoded default Nuklear font file and the baked sizes that LoadFontFromNuklear() keeps, which are
+ * otherwise kept for the lifetime of the process. Fonts that were loaded from them stay loaded.
+ *
+ * @see LoadFontFromNuklear()
+ */
+NK_API void UnloadNuklearDefaultFontCache(void) {
+#ifdef RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT
+#if RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES > 0
+    for (int i = 0; i < RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES; i++) {
+        if (raylib_nuklear_default_font_bakes[i].size != 0) {
+            raylib_nuklear_unload_font_bake(&raylib_nuklear_default_font_bakes[i]);
+        }
+    }
+    raylib_nuklear_default_font_next_bake = 0;
+#endif
+#if !defined(RAYLIB_NUKLEAR_DEFAULT_FONT_TTF) || !defined(RAYLIB_NUKLEAR_DEFAULT_FONT_TTF_SIZE)
+    MemFree(raylib_nuklear_default_font_ttf);
+    raylib_nuklear_default_font_ttf = NULL;
+    raylib_nuklear_default_font_ttf_size = 0;
+#endif
+#endif
+}
+
+/**
+ * Identifies font cache files, "RNFC".
+ *
+ * @see LoadFontFromNuklearCache()
+ */
+#define RAYLIB_NUKLEAR_FONT_CACHE_MAGIC 0x43464E52u
+
+/**
+ * The version of the font cache format, along with the version of raylib, which rasterizes the glyphs.
+ *
+ * @see LoadFontFromNuklearCache()
+ */
+#define RAYLIB_NUKLEAR_FONT_CACHE_VERSION (10000 + RAYLIB_VERSION_MAJOR * 100 + RAYLIB_VERSION_MINOR)
+
+/**
+ * The start of a font cache file, followed by its entries.
+ *
+ * @internal
+ */
+typedef struct NuklearFontCacheHeader {
+    unsigned int magic;   // RAYLIB_NUKLEAR_FONT_CACHE_MAGIC.
+    unsigned int version; // RAYLIB_NUKLEAR_FONT_CACHE_VERSION.
+} NuklearFontCacheHeader;
+
+/**
+ * A baked font in a font cache file. It's followed by the value, offsets and advance of each glyph as four ints, the
+ * glyph recs, and the atlas pixels.
+ *
+ * @internal
+ */
+typedef struct NuklearFontCacheEntry {
+    unsigned int fileHash;     // CRC32 of the font file.
+    int fileSize;              // The size of the font file.
+    int size;                  // The size that the font was baked at.
+    unsigned int glyphSetHash; // CRC32 of the codepoints, or 0 for codepoints from 32 up.
+    int codepointCount;        // The amount of codepoints that were asked for.
+    int glyphCount;            // The amount of glyphs.
+    int width;                 // The width of the atlas.
+    int height;                // The height of the atlas.
+    int format;                // The pixel format of the atlas.
+    unsigned int dataSize;     // The size of the glyphs, recs and pixels that follow.
+    unsigned int dataHash;     // CRC32 of the glyphs, recs and pixels that follow.
+} NuklearFontCacheEntry;
+
+/**
+ * Find the given font in a font cache file, and load it into a bake.
+ *
+ * Reading stops at the first entry that's cut off, or that's the font and doesn't match its hash.
+ *
+ * @param validSize Where to store how many bytes at the start of the file are valid, to keep them when saving.
+ *
+ * @return True when the font was found and loaded.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_font_cache_read(unsigned char* cache, int cacheSize, const NuklearFontCacheEntry* key, NuklearFontBake* bake, int* validSize)
+{
+    *validSize = 0;
+    NuklearFontCacheHeader header;
+    if (cache == NULL || cacheSize < (int)sizeof(header)) {
+        return false;
+    }
+    nk_memcopy(&header, cache, sizeof(header));
+    if (header.magic != RAYLIB_NUKLEAR_FONT_CACHE_MAGIC || header.version != RAYLIB_NUKLEAR_FONT_CACHE_VERSION) {
+        return false;
+    }
+
+    int offset = (int)sizeof(header);
+    *validSize = offset;
+    while (offset + (int)sizeof(NuklearFontCacheEntry) <= cacheSize) {
+        NuklearFontCacheEntry entry;
+        nk_memcopy(&entry, cache + offset, sizeof(entry));
+        if (entry.glyphCount <= 0 || entry.glyphCount > 0x10000 || entry.width <= 0 || entry.width > 16384 ||
+                entry.height <= 0 || entry.height > 16384) {
+            return false;
+        }
+        int pixelSize = GetPixelDataSize(entry.width, entry.height, entry.format);
+        size_t dataSize = (size_t)entry.glyphCount * (4 * sizeof(int) + sizeof(Rectangle)) + (size_t)pixelSize;
+        unsigned char* data = cache + offset + (int)sizeof(entry);
+        if (pixelSize <= 0 || entry.dataSize != dataSize || dataSize > (size_t)(cacheSize - offset) - sizeof(entry)) {
+            return false;
+        }
+
+        // Only the entry that's loaded is hashed, so that big cache files stay quick to read.
+        if (entry.fileHash != key->fileHash || entry.fileSize != key->fileSize || entry.size != key->size ||
+                entry.glyphSetHash != key->glyphSetHash || entry.codepointCount != key->codepointCount) {
+            offset += (int)(sizeof(entry) + dataSize);
+            *validSize = offset;
+            continue;
+        }
+        if (ComputeCRC32(data, (int)dataSize) != entry.dataHash) {
+            return false;
+        }
+
+        bake->glyphs = (GlyphInfo*)MemAlloc((unsigned int)((size_t)entry.glyphCount * sizeof(GlyphInfo)));
+        bake->recs = (Rectangle*)MemAlloc((unsigned int)((size_t)entry.glyphCount * sizeof(Rectangle)));
+        bake->atlas = CLITERAL(Image) {MemAlloc((unsigned int)pixelSize), entry.width, entry.height, 1, entry.format};
+        bake->size = entry.size;
+        bake->glyphCount = entry.glyphCount;
+        if (bake->glyphs == NULL || bake->recs == NULL || bake->atlas.data == NULL) {
+            raylib_nuklear_unload_font_bake(bake);
+            return false;
+        }
+        for (int i = 0; i < entry.glyphCount; i++) {
+            int glyph[4];
+            nk_memcopy(glyph, data + (size_t)i * sizeof(glyph), sizeof(glyph));
+            bake->glyphs[i] = CLITERAL(GlyphInfo) {glyph[0], glyph[1], glyph[2], glyph[3], CLITERAL(Image) {0}};
+        }
+        data += (size_t)entry.glyphCount * 4 * sizeof(int);
+        nk_memcopy(bake->recs, data, (nk_size)entry.glyphCount * sizeof(Rectangle));
+        data += (size_t)entry.glyphCount * sizeof(Rectangle);
+        nk_memcopy(bake->atlas.data, data, (nk_size)pixelSize);
+        return true;
+    }
+    return false;
+}
+
+/**
+ * Save a font cache file with the valid entries of the previous one, and the given bake.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_font_cache_write(const char* cacheFileName, const unsigned char* cache, int validSize, NuklearFontCacheEntry* entry, const NuklearFontBake* bake)
+{
+    int pixelSize = GetPixelDataSize(bake->atlas.width, bake->atlas.height, bake->atlas.format);
+    size_t dataSize = (size_t)bake->glyphCount * (4 * sizeof(int) + sizeof(Rectangle)) + (size_t)pixelSize;
+    if (validSize < (int)sizeof(NuklearFontCacheHeader)) {
+        validSize = (int)sizeof(NuklearFontCacheHeader);
+        cache = NULL;
+    }
+    size_t fileSize = (size_t)validSize + sizeof(NuklearFontCacheEntry) + dataSize;
+    unsigned char* file = (unsigned char*)MemAlloc((unsigned int)fileSize);
+    if (file == NULL) {
+        return;
+    }
+
+    if (cache != NULL) {
+        nk_memcopy(file, cache, (nk_size)validSize);
+    }
+    else {
+        NuklearFontCacheHeader header = {RAYLIB_NUKLEAR_FONT_CACHE_MAGIC, RAYLIB_NUKLEAR_FONT_CACHE_VERSION};
+        nk_memcopy(file, &header, sizeof(header));
+    }
+
+    unsigned char* data = file + validSize + sizeof(NuklearFontCacheEntry);
+    for (int i = 0; i < bake->glyphCount; i++) {
+        int glyph[4] = {bake->glyphs[i].value, bake->glyphs[i].offsetX, bake->glyphs[i].offsetY, bake->glyphs[i].advanceX};
+        nk_memcopy(data + (size_t)i * sizeof(glyph), glyph, sizeof(glyph));
+    }
+    nk_memcopy(data + (size_t)bake->glyphCount * 4 * sizeof(int), bake->recs, (nk_size)bake->glyphCount * sizeof(Rectangle));
+    nk_memcopy(data + (size_t)bake->glyphCount * (4 * sizeof(int) + sizeof(Rectangle)), bake->atlas.data, (nk_size)pixelSize);
+
+    entry->glyphCount = bake->glyphCount;
+    entry->width = bake->atlas.width;
+    entry->height = bake->atlas.height;
+    entry->format = bake->atlas.format;
+    entry->dataSize = (unsigned int)dataSize;
+    entry->dataHash = ComputeCRC32(data, (int)dataSize);
+    nk_memcopy(file + validSize, entry, sizeof(NuklearFontCacheEntry));
+
+    if (!SaveFileData(cacheFileName, file, (int)fileSize)) {
+        TraceLog(LOG_WARNING, "NUKLEAR: Failed to save the font cache %s", cacheFileName);
+    }
+    MemFree(file);
+}
+
+/**
+ * Load a font like LoadFontEx() does, reusing its atlas and glyphs from a cache file when the font was baked before.
+ *
+ * Fonts are cached by the hash of the font file, the size and the codepoints, so changed font files are baked again.
+ * Cache misses are baked and added to the cache file, which can hold any amount of fonts and sizes. Cache files that
+ * are corrupt, or from another version of raylib, are baked again without notice.
+ *
+ * @param cacheFileName The cache file, which is created when it doesn't exist.
+ * @param fileName The TTF or OTF font file.
+ * @param fontSize The size to bake the font at.
+ * @param codepoints The codepoints to bake, or NULL for printable ASCII.
+ * @param codepointCount The amount of codepoints, or 0 for printable ASCII.
+ *
+ * @return The font, or an empty font on error. Unload it with UnloadFont().
+ *
+ * @code
+ * Font font = LoadFontFromNuklearCache("fonts.cache", "resources/font.ttf", 20, NULL, 0);
+ * struct nk_context* ctx = InitNuklearEx(font, 20.0f);
+ * @endcode
+ */
+NK_API Font
+LoadFontFromNuklearCache(const char* cacheFileName, const char* fileName, int fontSize, int* codepoints, int codepointCount)
+{
+    int fileSize = 0;
+    unsigned char* fileData = LoadFileData(fileName, &fileSize);
+    if (fileData == NULL || fileSize <= 0 || fontSize <= 0) {
+        TraceLog(LOG_WARNING, "NUKLEAR: Failed to load font %s", fileName);
+        UnloadFileData(fileData);
+        return CLITERAL(Font) {0};
+    }
+
+    NuklearFontCacheEntry key = {0};
+    key.fileHash = ComputeCRC32(fileData, fileSize);
+    key.fileSize = fileSize;
+    key.size = fontSize;
+    key.codepointCount = (codepointCount > 0) ? codepointCount : 95;
+    key.glyphSetHash = (codepoints != NULL) ? ComputeCRC32((unsigned char*)codepoints, key.codepointCount * (int)sizeof(int)) : 0;
+
+    // The cache is read into memory, as raylib has no portable way to map files.
+    int cacheSize = 0;
+    unsigned char* cache = (cacheFileName != NULL && FileExists(cacheFileName)) ? LoadFileData(cacheFileName, &cacheSize) : NULL;
+    int validSize = 0;
+    NuklearFontBake bake = {0};
+    Font font = {0};
+    if (raylib_nuklear_font_cache_read(cache, cacheSize, &key, &bake, &validSize)) {
+        font = raylib_nuklear_load_font_bake(&bake);
+    }
+    else {
+        raylib_nuklear_unload_font_bake(&bake);
+        if (raylib_nuklear_bake_font(fileData, fileSize, fontSize, codepoints, key.codepointCount, &bake)) {
+            font = raylib_nuklear_load_font_bake(&bake);
+            if (cacheFileName != NULL) {
+                raylib_nuklear_font_cache_write(cacheFileName, cache, validSize, &key, &bake);
+            }
+        }
+        else {
+            TraceLog(LOG_WARNING, "NUKLEAR: Failed to bake font %s", fileName);
+        }
+    }
+
+    raylib_nuklear_unload_font_bake(&bake);
+    UnloadFileData(cache);
+    UnloadFileData(fileData);
+    return font;
+}
+
+/**
+ * Convert the given Nuklear color to a raylib color.
+ */
+NK_API Color
+NuklearColorToColor(struct nk_color color)
+{
+    Color rc;
+    rc.a = color.a;
+    rc.r = color.r;
+    rc.g = color.g;
+    rc.b = color.b;
+    return rc;
+}
+
+/**
+ * Convert the given raylib color to a Nuklear color.
+ */
+NK_API struct nk_color
+ColorToNuklearColor(Color color)
+{
+    struct nk_color rc;
+    rc.a = color.a;
+    rc.r = color.r;
+    rc.g = color.g;
+    rc.b = color.b;
+    return rc;
+}
+
+/**
+ * Convert the given Nuklear float color to a raylib color.
+ */
+NK_API Color
+NuklearColorFToColor(struct nk_colorf color)
+{
+    return NuklearColorToColor(nk_rgba_cf(color));
+}
+
+/**
+ * Convert the given raylib color to a raylib float color.
+ */
+NK_API struct nk_colorf
+ColorToNuklearColorF(Color color)
+{
+    return nk_color_cf(ColorToNuklearColor(color));
+}
+
+/**
+ * Convert the given Nuklear image to a raylib Texture
+ *
+ * @internal
+ */
+static struct Texture
+NuklearImageToTexture(struct nk_image img)
+{
+	Texture texture = {0};
+	texture.id = (unsigned int)img.handle.id;
+	texture.width = (int)img.w;
+	texture.height = (int)img.h;
+	texture.mipmaps = 1;
+	return texture;
+}
+
+/**
+ * Twice the signed area of the triangle (a, b, c). Negative when the points wind the way raylib's DrawTriangle() expects.
+ *
+ * @internal
+ */
+static float raylib_nuklear_triangle_area(Vector2 a, Vector2 b, Vector2 c) {
+    return (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+}
+
+/**
+ * Find where the edges of a polygon cross each other, leaving out edges that only touch.
+ *
+ * @param ys Output for the y of each crossing, or NULL to only count them.
+ *
+ * @return The amount of crossings.
+ *
+ * @internal
+ */
+static int raylib_nuklear_polygon_crossings(const Vector2 *points, int count, float *ys) {
+    int crossings = 0;
+    for (int i = 0; i < count - 2; i++) {
+        Vector2 a = points[i], b = points[i + 1];
+        for (int j = i + 2; j < count; j++) {
+            if (i == 0 && j == count - 1) continue;  // The edges are adjacent.
+            Vector2 c = points[j], d = points[(j + 1) % count];
+            float d1 = raylib_nuklear_triangle_area(a, b, c);
+            float d2 = raylib_nuklear_triangle_area(a, b, d);
+            float d3 = raylib_nuklear_triangle_area(c, d, a);
+            float d4 = raylib_nuklear_triangle_area(c, d, b);
+            if (((d1 < 0.0f && d2 > 0.0f) || (d1 > 0.0f && d2 < 0.0f)) && ((d3 < 0.0f && d4 > 0.0f) || (d3 > 0.0f && d4 < 0.0f))) {
+                if (ys != NULL) {
+                    ys[crossings] = a.y + (b.y - a.y) * (d3 / (d3 - d4));
+                }
+                crossings++;
+            }
+        }
+    }
+    return crossings;
+}
+
+/**
+ * Triangulate the given polygon into a triangle list, using a fan for convex polygons and ear clipping otherwise.
+ *
+ * Degenerate input never loops forever: when no ear can be found, the current vertex is clipped anyway. Polygons whose
+ * edges cross aren't triangulated, as their triangles would overlap where the even-odd rule leaves holes.
+ *
+ * @param points The polygon points.
+ * @param count The amount of points.
+ * @param remaining Scratch space for `count` vertex indices.
+ * @param triangles Output for `(count - 2) * 3` vertex indices, wound the way DrawTriangle() expects.
+ *
+ * @return The amount of triangles written, or -1 when the polygon intersects itself.
+ *
+ * @see raylib_nuklear_fill_polygon_even_odd()
+ *
+ * @internal
+ */
+static int raylib_nuklear_triangulate_polygon(const Vector2 *points, int count, int *remaining, int *triangles) {
+    if (count < 3) return 0;
+
+    // Signed area, convexity and total turning of the polygon.
+    float area = 0.0f;
+    float turning = 0.0f;
+    bool positive = false, negative = false;
+    for (int i = 0; i < count; i++) {
+        Vector2 a = points[i], b = points[(i + 1) % count], c = points[(i + 2) % count];
+        area += a.x * b.y - b.x * a.y;
+        float turn = raylib_nuklear_triangle_area(a, b, c);
+        if (turn > 0.0f) positive = true;
+        else if (turn < 0.0f) negative = true;
+        turning += atan2f(turn, (b.x - a.x) * (c.x - b.x) + (b.y - a.y) * (c.y - b.y));
+    }
+
+    // Turning the same way throughout isn't enough to be convex, as stars like {5/2} do that while going around twice,
+    // so the polygon also needs to turn around exactly once. Anything else may cross itself, even with no area left.
+    bool convex = !(positive && negative) && fabsf(turning) < 3.0f * PI;
+    if (!convex && raylib_nuklear_polygon_crossings(points, count, NULL) > 0) return -1;
+    if (area == 0.0f) return 0;
+
+    // Emit triangles in the winding DrawTriangle() expects, regardless of the polygon winding.
+    bool flip = area > 0.0f;
+    int triangleCount = 0;
+    #define RAYLIB_NUKLEAR_EMIT_TRIANGLE(a, b, c) do { \
+        triangles[triangleCount * 3] = (a); \
+        triangles[triangleCount * 3 + 1] = flip ? (c) : (b); \
+        triangles[triangleCount * 3 + 2] = flip ? (b) : (c); \
+        triangleCount++; \
+    } while (0)
+
+    // Convex fast path: a simple fan.
+    if (convex) {
+        for (int i = 1; i < count - 1; i++) {
+            RAYLIB_NUKLEAR_EMIT_TRIANGLE(0, i, i + 1);
+        }
+        return triangleCount;
+    }
+
+    // Ear clipping for concave polygons.
+    for (int i = 0; i < count; i++) {
+        remaining[i] = i;
+    }
+    int left = count;
+    int current = 0;
+    int misses = 0;
+    while (left > 3) {
+        int prev = remaining[(current + left - 1) % left];
+        int curr = remaining[current];
+        int next = remaining[(current + 1) % left];
+        Vector2 a = points[prev], b = points[curr], c = points[next];
+        float turn = raylib_nuklear_triangle_area(a, b, c);
+
+        // The vertex is an ear when it's convex, and no other remaining vertex is inside of its triangle.
+        bool ear = (area > 0.0f) ? (turn > 0.0f) : (turn < 0.0f);
+        for (int j = 0; ear && j < left; j++) {
+            int other = remaining[j];
+            if (other == prev || other == curr || other == next) continue;
+            Vector2 p = points[other];
+            float d1 = raylib_nuklear_triangle_area(a, b, p);
+            float d2 = raylib_nuklear_triangle_area(b, c, p);
+            float d3 = raylib_nuklear_triangle_area(c, a, p);
+            bool hasNegative = (d1 < 0.0f) || (d2 < 0.0f) || (d3 < 0.0f);
+            bool hasPositive = (d1 > 0.0f) || (d2 > 0.0f) || (d3 > 0.0f);
+            if (!(hasNegative && hasPositive)) ear = false;
+        }
+
+        if (ear || misses >= left) {
+            if (turn != 0.0f) {
+                RAYLIB_NUKLEAR_EMIT_TRIANGLE(prev, curr, next);
+            }
+            for (int j = current; j < left - 1; j++) {
+                remaining[j] = remaining[j + 1];
+            }
+            left--;
+            if (current >= left) current = 0;
+            misses = 0;
+        } else {
+            current = (current + 1) % left;
+            misses++;
+        }
+    }
+    if (raylib_nuklear_triangle_area(points[remaining[0]], points[remaining[1]], points[remaining[2]]) != 0.0f) {
+        RAYLIB_NUKLEAR_EMIT_TRIANGLE(remaining[0], remaining[1], remaining[2]);
+    }
+    #undef RAYLIB_NUKLEAR_EMIT_TRIANGLE
+
+    return triangleCount;
+}
+
+/**
+ * Fill a polygon by the even-odd rule as a triangle list, for polygons that intersect themselves.
+ *
+ * The polygon is cut into horizontal slabs at its vertices and crossings, so that no edges cross within a slab. The
+ * edges through each slab are sorted, and every other gap between them is filled with a trapezoid.
+ *
+ * @param points The polygon points.
+ * @param count The amount of points.
+ * @param ys Scratch space for as many floats as the polygon has points and crossings.
+ * @param edges Scratch space for `count` edge indices.
+ * @param xs Scratch space for `count` floats.
+ * @param vertices Output for the triangle vertices, wound the way DrawTriangle() expects, or NULL to only count them.
+ *
+ * @return The amount of vertices.
+ *
+ * @internal
+ */
+static int raylib_nuklear_fill_polygon_even_odd(const Vector2 *points, int count, float *ys, int *edges, float *xs, Vector2 *vertices) {
+    // Sort the heights of the crossings and vertices.
+    int crossings = raylib_nuklear_polygon_crossings(points, count, ys);
+    int yCount = crossings + count;
+    for (int i = 0; i < count; i++) {
+        ys[crossings + i] = points[i].y;
+    }
+    for (int i = 1; i < yCount; i++) {
+        float y = ys[i];
+        int j = i;
+        for (; j > 0 && ys[j - 1] > y; j--) {
+            ys[j] = ys[j - 1];
+        }
+        ys[j] = y;
+    }
+
+    int vertexCount = 0;
+    for (int s = 0; s + 1 < yCount; s++) {
+        float top = ys[s], bottom = ys[s + 1];
+        if (bottom <= top) continue;
+
+        // Sort the edges through the slab by where they cross its middle.
+        float middle = (top + bottom) * 0.5f;
+        int edgeCount = 0;
+        for (int i = 0; i < count; i++) {
+            Vector2 a = points[i], b = points[(i + 1) % count];
+            if ((a.y > middle) == (b.y > middle)) continue;
+            float x = a.x + (middle - a.y) * (b.x - a.x) / (b.y - a.y);
+            int j = edgeCount++;
+            for (; j > 0 && xs[j - 1] > x; j--) {
+                xs[j] = xs[j - 1];
+                edges[j] = edges[j - 1];
+            }
+            xs[j] = x;
+            edges[j] = i;
+        }
+
+        // Fill between every other pair of edges.
+        for (int e = 0; e + 1 < edgeCount; e += 2) {
+            Vector2 corners[4];
+            for (int k = 0; k < 2; k++) {
+                Vector2 a = points[edges[e + k]], b = points[(edges[e + k] + 1) % count];
+                float slope = (b.x - a.x) / (b.y - a.y);
+                corners[k] = CLITERAL(Vector2) {a.x + (top - a.y) * slope, top};
+                corners[3 - k] = CLITERAL(Vector2) {a.x + (bottom - a.y) * slope, bottom};
+            }
+
+            // The top left, top right, bottom right and bottom left corners, in two triangles that skip the corner
+            // where the edges meet.
+            const int quad[6] = {0, 3, 2, 0, 2, 1};
+            for (int t = 0; t < 6; t += 3) {
+                Vector2 a = corners[quad[t]], b = corners[quad[t + 1]], c = corners[quad[t + 2]];
+                if (raylib_nuklear_triangle_area(a, b, c) >= 0.0f) continue;
+                if (vertices != NULL) {
+                    vertices[vertexCount] = a;
+                    vertices[vertexCount + 1] = b;
+                    vertices[vertexCount + 2] = c;
+                }
+                vertexCount += 3;
+            }
+        }
+    }
+    return vertexCount;
+}
+
+/**
+ * Begin drawing triangles with raylib's shapes texture, the way raylib's own shapes do, so that they batch with them.
+ *
+ * @see raylib_nuklear_end_shapes()
+ *
+ * @internal
+ */
+static void raylib_nuklear_begin_shapes(void) {
+#if RAYLIB_VERSION_MAJOR >= 5
+    Texture2D texture = GetShapesTexture();
+    Rectangle source = GetShapesTextureRectangle();
+    rlSetTexture(texture.id);
+    rlBegin(RL_TRIANGLES);
+    if (texture.width > 0 && texture.height > 0) {
+        rlTexCoord2f((source.x + source.width * 0.5f) / (float)texture.width, (source.y + source.height * 0.5f) / (float)texture.height);
+    }
+#else
+    rlBegin(RL_TRIANGLES);
+#endif
+}
+
+/**
+ * End drawing triangles that were started with raylib_nuklear_begin_shapes().
+ *
+ * @internal
+ */
+static void raylib_nuklear_end_shapes(void) {
+    rlEnd();
+#if RAYLIB_VERSION_MAJOR >= 5
+    rlSetTexture(0);
+#endif
+}
+
+/**
+ * Grow the scratch memory for filling a polygon to at least the given size, keeping its contents.
+ *
+ * @param scratch The current scratch memory, which is only owned by the caller when userData is NULL.
+ *
+ * @return The scratch memory, or NULL when it couldn't be grown.
+ *
+ * @internal
+ */
+static void* raylib_nuklear_grow_polygon_scratch(NuklearUserData* userData, void* scratch, size_t size) {
+    if (userData == NULL) {
+        return MemRealloc(scratch, (unsigned int)size);
+    }
+    if (userData->polygon_scratch_size < size) {
+        void* grown = MemRealloc(userData->polygon_scratch, (unsigned int)size);
+        if (grown == NULL) return NULL;
+        userData->polygon_scratch = grown;
+        userData->polygon_scratch_size = size;
+    }
+    return userData->polygon_scratch;
+}
+
+/**
+ * Draw a filled polygon using Nuklear values, as a single triangle list.
+ *
+ * The scratch memory is kept in the user data so that it's reused across frames.
+ *
+ * @internal
+ */
+static void raylib_nuklear_draw_polygon_fill(NuklearUserData* userData, float scale, const struct nk_vec2i *pnts, int count, Color col) {
+    if (count < 3) return;
+
+    // Scaled points, remaining ear clipping indices, and the output triangle indices.
+    size_t size = (size_t)count * sizeof(Vector2) + (size_t)count * sizeof(int) + (size_t)(count - 2) * 3 * sizeof(int);
+    void* scratch = raylib_nuklear_grow_polygon_scratch(userData, NULL, size);
+    if (scratch == NULL) return;
+
+    Vector2* points = (Vector2*)scratch;
+    int* remaining = (int*)(points + count);
+    int* triangles = remaining + count;
+    for (int i = 0; i < count; i++) {
+        points[i].x = (float)pnts[i].x * scale;
+        points[i].y = (float)pnts[i].y * scale;
+    }
+
+    int triangleCount = raylib_nuklear_triangulate_polygon(points, count, remaining, triangles);
+    if (triangleCount > 0) {
+        raylib_nuklear_begin_shapes();
+            rlColor4ub(col.r, col.g, col.b, col.a);
+            for (int i = 0; i < triangleCount * 3; i++) {
+                rlVertex2f(points[triangles[i]].x, points[triangles[i]].y);
+            }
+        raylib_nuklear_end_shapes();
+    }
+    else if (triangleCount < 0) {
+        // The polygon intersects itself, so fill it by the even-odd rule instead, after the scaled points: the crossing
+        // and vertex heights, the edge indices and positions of a slab, and the output vertices once they're counted.
+        int crossings = raylib_nuklear_polygon_crossings(points, count, NULL);
+        size = (size_t)count * sizeof(Vector2) + (size_t)(crossings + count) * sizeof(float) + (size_t)count * (sizeof(int) + sizeof(float));
+        void* grown = raylib_nuklear_grow_polygon_scratch(userData, scratch, size);
+        if (grown != NULL) {
+            scratch = grown;
+            points = (Vector2*)scratch;
+            float* ys = (float*)(points + count);
+            int vertexCount = raylib_nuklear_fill_polygon_even_odd(points, count, ys, (int*)(ys + crossings + count), ys + crossings + count * 2, NULL);
+
+            // Vector2 is aligned like its floats, so the vertices can follow them directly.
+            grown = raylib_nuklear_grow_polygon_scratch(userData, scratch, size + (size_t)vertexCount * sizeof(Vector2));
+            if (grown != NULL) {
+                scratch = grown;
+                points = (Vector2*)scratch;
+                ys = (float*)(points + count);
+                Vector2* vertices = (Vector2*)((char*)scratch + size);
+                raylib_nuklear_fill_polygon_even_odd(points, count, ys, (int*)(ys + crossings + count), ys + crossings + count * 2, vertices);
+                raylib_nuklear_begin_shapes();
+                    rlColor4ub(col.r, col.g, col.b, col.a);
+                    for (int i = 0; i < vertexCount; i++) {
+                        rlVertex2f(vertices[i].x, vertices[i].y);
+                    }
+                raylib_nuklear_end_shapes();
+            }
+        }
+    }
+
+    if (userData == NULL) {
+        MemFree(scratch);
+    }
+}
+
+/**
+ * The cached points of a unit circle, with RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX segments.
+ *
+ * Circles with fewer segments step through the table, as all segment counts are powers of two.
+ *
+ * @see raylib_nuklear_get_unit_circle()
+ */
+static Vector2 raylib_nuklear_unit_circle[RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX];
+
+/**
+ * Whether raylib_nuklear_unit_circle has been calculated.
+ */
+static bool raylib_nuklear_unit_circle_ready = false;
+
+/**
+ * Get the cached unit circle table, calculating it on first use.
+ *
+ * Index i is at the angle of i / RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX turns, clockwise on the screen from the positive x axis.
+ *
+ * @internal
+ */
+static const Vector2*
+raylib_nuklear_get_unit_circle(void)
+{
+    if (!raylib_nuklear_unit_circle_ready) {
+        for (int i = 0; i < RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX; i++) {
+            float angle = 2.0f * PI * (float)i / (float)RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX;
+            raylib_nuklear_unit_circle[i] = CLITERAL(Vector2) {cosf(angle), sinf(angle)};
+        }
+        raylib_nuklear_unit_circle_ready = true;
+    }
+
+    return raylib_nuklear_unit_circle;
+}
+
+/**
+ * Get the amount of segments for a full circle with the given on-screen radius, so that no point of the circle is
+ * further than RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE from its segments.
+ *
+ * @param radius The radius in pixels, with the scaling applied.
+ *
+ * @return A power of two between 8 and RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX.
+ *
+ * @internal
+ */
+static int
+raylib_nuklear_circle_segments(float radius)
+{
+    int segments = 8;
+    if (radius > RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE) {
+        // A segment spanning the angle a is at most radius * (1 - cos(a / 2)) away from the circle.
+        float maxAngle = 2.0f * acosf(1.0f - RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE / radius);
+        float required = 2.0f * PI / maxAngle;
+        while (segments < RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX && (float)segments < required) {
+            segments *= 2;
+        }
+    }
+
+    return segments;
+}
+
+/**
+ * Emit a triangle with rlgl, in counter-clockwise order on the screen.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_emit_triangle(Vector2 a, Vector2 b, Vector2 c)
+{
+    if ((b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x) > 0.0f) {
+        Vector2 swap = b;
+        b = c;
+        c = swap;
+    }
+
+    rlVertex2f(a.x, a.y);
+    rlVertex2f(b.x, b.y);
+    rlVertex2f(c.x, c.y);
+}
+
+/**
+ * Emit one segment of a ring, or of a circle sector when the inner radius is 0, between the unit directions a and b.
+ *
+ * The direction b must be clockwise on the screen from a.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_emit_ring_segment(Vector2 center, float innerRadius, float outerRadius, Vector2 a, Vector2 b)
+{
+    if (innerRadius <= 0.0f) {
+        rlVertex2f(center.x, center.y);
+        rlVertex2f(center.x + b.x * outerRadius, center.y + b.y * outerRadius);
+        rlVertex2f(center.x + a.x * outerRadius, center.y + a.y * outerRadius);
+        return;
+    }
+
+    rlVertex2f(center.x + a.x * outerRadius, center.y + a.y * outerRadius);
+    rlVertex2f(center.x + a.x * innerRadius, center.y + a.y * innerRadius);
+    rlVertex2f(center.x + b.x * innerRadius, center.y + b.y * innerRadius);
+
+    rlVertex2f(center.x + b.x * innerRadius, center.y + b.y * innerRadius);
+    rlVertex2f(center.x + b.x * outerRadius, center.y + b.y * outerRadius);
+    rlVertex2f(center.x + a.x * outerRadius, center.y + a.y * outerRadius);
+}
+
+/**
+ * Draw a ring or circle sector along the cached unit circle, with the amount of segments picked from the radius.
+ *
+ * @param center The center of the ring.
+ * @param innerRadius The inner radius. Use 0 for a filled sector.
+ * @param outerRadius The outer radius.
+ * @param quarter The quarter turn to start at, clockwise on the screen from the positive x axis.
+ * @param quarters The amount of quarter turns to draw.
+ * @param color The color.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_draw_ring_quarters(Vector2 center, float innerRadius, float outerRadius, int quarter, int quarters, Color color)
+{
+    if (outerRadius <= 0.0f || quarters <= 0) return;
+
+    const Vector2* circle = raylib_nuklear_get_unit_circle();
+    const int mask = RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX - 1;
+    const int stride = RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX / raylib_nuklear_circle_segments(outerRadius);
+    const int first = quarter * RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX / 4;
+    const int last = first + quarters * RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX / 4;
+
+    raylib_nuklear_begin_shapes();
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        for (int i = first; i < last; i += stride) {
+            raylib_nuklear_emit_ring_segment(center, innerRadius, outerRadius, circle[i & mask], circle[(i + stride) & mask]);
+        }
+    raylib_nuklear_end_shapes();
+}
+
+/**
+ * Get the amount of segments for a full ellipse, from its perimeter, so that each segment is short enough to stay
+ * within RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE of its most gently curved part.
+ *
+ * For circles, this matches raylib_nuklear_circle_segments().
+ *
+ * @return A power of two between 8 and RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX.
+ *
+ * @internal
+ */
+static int
+raylib_nuklear_ellipse_segments(float radiusX, float radiusY)
+{
+    float a = NK_MAX(radiusX, radiusY);
+    float b = NK_MIN(radiusX, radiusY);
+    if (a <= RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE) {
+        return 8;
+    }
+
+    // Ramanujan's approximation of the perimeter, split into chords that deviate at most the tolerance from a circle of radius a.
+    float perimeter = PI * (3.0f * (a + b) - sqrtf((3.0f * a + b) * (a + 3.0f * b)));
+    float chord = 2.0f * a * sinf(acosf(1.0f - RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE / a));
+    float required = perimeter / chord;
+    int segments = 8;
+    while (segments < RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX && (float)segments < required) {
+        segments *= 2;
+    }
+
+    return segments;
+}
+
+/**
+ * Draw a filled ellipse, or an elliptical ring, in one pass along the cached unit circle.
+ *
+ * @param center The center of the ellipse.
+ * @param radiusX The horizontal radius.
+ * @param radiusY The vertical radius.
+ * @param thickness The thickness of the ring, inwards from the edge. Use 0 to fill the ellipse.
+ * @param color The color.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_draw_ellipse(Vector2 center, float radiusX, float radiusY, float thickness, Color color)
+{
+    if (radiusX <= 0.0f || radiusY <= 0.0f) return;
+
+    const Vector2* circle = raylib_nuklear_get_unit_circle();
+    const int mask = RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX - 1;
+    const int stride = RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX / raylib_nuklear_ellipse_segments(radiusX, radiusY);
+    const bool filled = thickness <= 0.0f || thickness >= NK_MIN(radiusX, radiusY);
+    const float innerX = filled ? 0.0f : radiusX - thickness;
+    const float innerY = filled ? 0.0f : radiusY - thickness;
+
+    raylib_nuklear_begin_shapes();
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        for (int i = 0; i < RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX; i += stride) {
+            Vector2 a = circle[i];
+            Vector2 b = circle[(i + stride) & mask];
+            Vector2 outerA = {center.x + a.x * radiusX, center.y + a.y * radiusY};
+            Vector2 outerB = {center.x + b.x * radiusX, center.y + b.y * radiusY};
+            if (filled) {
+                rlVertex2f(center.x, center.y);
+                rlVertex2f(outerB.x, outerB.y);
+                rlVertex2f(outerA.x, outerA.y);
+                continue;
+            }
+
+            Vector2 innerA = {center.x + a.x * innerX, center.y + a.y * innerY};
+            Vector2 innerB = {center.x + b.x * innerX, center.y + b.y * innerY};
+            rlVertex2f(outerA.x, outerA.y);
+            rlVertex2f(innerA.x, innerA.y);
+            rlVertex2f(innerB.x, innerB.y);
+
+            rlVertex2f(innerB.x, innerB.y);
+            rlVertex2f(outerB.x, outerB.y);
+            rlVertex2f(outerA.x, outerA.y);
+        }
+    raylib_nuklear_end_shapes();
+}
+
+/**
+ * Draw a ring or circle sector between two arbitrary angles, with the amount of segments picked from the radius.
+ *
+ * The directions are rotated by a constant step, so only the first direction and the step need trigonometry.
+ *
+ * @param center The center of the arc.
+ * @param innerRadius The inner radius. Use 0 for a filled sector.
+ * @param outerRadius The outer radius.
+ * @param startAngle The starting angle, in radians.
+ * @param endAngle The ending angle, in radians.
+ * @param color The color.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_draw_arc(Vector2 center, float innerRadius, float outerRadius, float startAngle, float endAngle, Color color)
+{
+    if (outerRadius <= 0.0f || startAngle == endAngle) return;
+
+    // Always step clockwise on the screen.
+    if (endAngle < startAngle) {
+        float swap = startAngle;
+        startAngle = endAngle;
+        endAngle = swap;
+    }
+
+    float span = NK_MIN(endAngle - startAngle, 2.0f * PI);
+    int segments = (int)ceilf((float)raylib_nuklear_circle_segments(outerRadius) * span / (2.0f * PI));
+    if (segments < 1) segments = 1;
+
+    float step = span / (float)segments;
+    float stepCos = cosf(step);
+    float stepSin = sinf(step);
+    Vector2 a = {cosf(startAngle), sinf(startAngle)};
+
+    raylib_nuklear_begin_shapes();
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        for (int i = 0; i < segments; i++) {
+            Vector2 b = {a.x * stepCos - a.y * stepSin, a.x * stepSin + a.y * stepCos};
+            raylib_nuklear_emit_ring_segment(center, innerRadius, outerRadius, a, b);
+            a = b;
+        }
+    raylib_nuklear_end_shapes();
+}
+
+/**
+ * Get the amount of segments for a cubic bezier curve, so that it's within RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE of the true curve.
+ *
+ * Uses Wang's formula, based on how far the control points are from being evenly spaced on a line.
+ *
+ * @internal
+ */
+static int
+raylib_nuklear_curve_segments(Vector2 p0, Vector2 p1, Vector2 p2, Vector2 p3)
+{
+    float dx1 = p0.x - 2.0f * p1.x + p2.x;
+    float dy1 = p0.y - 2.0f * p1.y + p2.y;
+    float dx2 = p1.x - 2.0f * p2.x + p3.x;
+    float dy2 = p1.y - 2.0f * p2.y + p3.y;
+    float deviation = sqrtf(NK_MAX(dx1 * dx1 + dy1 * dy1, dx2 * dx2 + dy2 * dy2));
+    int segments = (int)ceilf(sqrtf(0.75f * deviation / RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE));
+    return NK_CLAMP(1, segments, RAYLIB_NUKLEAR_CURVE_SEGMENTS_MAX);
+}
+
+/**
+ * Draw a thick cubic bezier curve, with the amount of segments picked from how much it bends.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_draw_curve(Vector2 p0, Vector2 p1, Vector2 p2, Vector2 p3, float thickness, Color color)
+{
+    const int segments = raylib_nuklear_curve_segments(p0, p1, p2, p3);
+    const float half = thickness * 0.5f;
+
+    Vector2 previous = p0;
+    Vector2 previousLeft = p0;
+    Vector2 previousRight = p0;
+    bool started = false;
+
+    raylib_nuklear_begin_shapes();
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        for (int i = 1; i <= segments; i++) {
+            float t = (float)i / (float)segments;
+            float u = 1.0f - t;
+            float w0 = u * u * u;
+            float w1 = 3.0f * u * u * t;
+            float w2 = 3.0f * u * t * t;
+            float w3 = t * t * t;
+            Vector2 current = {
+                w0 * p0.x + w1 * p1.x + w2 * p2.x + w3 * p3.x,
+                w0 * p0.y + w1 * p1.y + w2 * p2.y + w3 * p3.y
+            };
+
+            float dx = current.x - previous.x;
+            float dy = current.y - previous.y;
+            float length = sqrtf(dx * dx + dy * dy);
+            if (length <= 0.0f) continue;
+            Vector2 normal = {-dy / length * half, dx / length * half};
+
+            // The first segment starts with its own normal, the others continue from the previous segment's edge.
+            if (!started) {
+                previousLeft = CLITERAL(Vector2) {previous.x + normal.x, previous.y + normal.y};
+                previousRight = CLITERAL(Vector2) {previous.x - normal.x, previous.y - normal.y};
+                started = true;
+            }
+            Vector2 left = {current.x + normal.x, current.y + normal.y};
+            Vector2 right = {current.x - normal.x, current.y - normal.y};
+
+            raylib_nuklear_emit_triangle(previousLeft, previousRight, right);
+            raylib_nuklear_emit_triangle(right, left, previousLeft);
+
+            previous = current;
+            previousLeft = left;
+            previousRight = right;
+        }
+    raylib_nuklear_end_shapes();
+}
+
+/**
+ * The vertex shader for SetNuklearSDFShapes().
+ *
+ * Vertices with a z of at least 1 are signed distance field shapes, with the shape parameters encoded in z. Every other
+ * vertex is passed through like raylib's default shader, so that text and images batch along with the shapes.
+ *
+ * @see raylib_nuklear_sdf_encode()
+ */
+static const char raylib_nuklear_sdf_vs[] =
+    "VS_IN vec3 vertexPosition;\n"
+    "VS_IN vec2 vertexTexCoord;\n"
+    "VS_IN vec4 vertexColor;\n"
+    "VS_OUT vec2 fragTexCoord;\n"
+    "VS_OUT vec4 fragColor;\n"
+    "VS_OUT float fragShape;\n"
+    "uniform mat4 mvp;\n"
+    "void main() {\n"
+    "    fragTexCoord = vertexTexCoord;\n"
+    "    fragColor = vertexColor;\n"
+    "    bool shape = vertexPosition.z >= 0.5;\n"
+    "    fragShape = shape ? vertexPosition.z : 0.0;\n"
+    "    gl_Position = mvp * vec4(vertexPosition.xy, shape ? -0.5 : vertexPosition.z, 1.0);\n"
+    "}\n";
+
+/**
+ * The fragment shader for SetNuklearSDFShapes().
+ *
+ * For shapes, the texture coordinates are the offset from the corner circle's center, in pixels, mirrored into the
+ * positive quadrant. That gives the distance to a rounded rectangle, which is antialiased over one pixel.
+ */
+static const char raylib_nuklear_sdf_fs[] =
+    "FS_IN vec2 fragTexCoord;\n"
+    "FS_IN vec4 fragColor;\n"
+    "FS_IN float fragShape;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "FS_OUTPUT\n"
+    "void main() {\n"
+    "    if (fragShape < 0.5) {\n"
+    "        FS_COLOR = TEXTURE(texture0, fragTexCoord) * colDiffuse * fragColor;\n"
+    "        return;\n"
+    "    }\n"
+    "    float shape = fragShape - 1.0;\n"
+    "    float radius = floor(shape) * 0.25;\n"
+    "    float thickness = fract(shape) * 256.0 - 0.5;\n"
+    "    vec2 q = fragTexCoord;\n"
+    "    float d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - radius;\n"
+    "    if (thickness > 0.1) d = max(d, -thickness - d);\n"
+    "    FS_COLOR = vec4(fragColor.rgb, fragColor.a * clamp(0.5 - d, 0.0, 1.0)) * colDiffuse;\n"
+    "}\n";
+
+/**
+ * The fragment shader for signed distance field fonts, which uses raylib_nuklear_sdf_vs as its vertex shader.
+ *
+ * The glyph's alpha is the distance to its outline, with the outline at 0.5. It's antialiased over the distance that
+ * changes from one pixel to the next, so it stays one pixel wide at any scale.
+ *
+ * @see LoadNuklearSDFFont()
+ */
+static const char raylib_nuklear_sdf_text_fs[] =
+    "FS_IN vec2 fragTexCoord;\n"
+    "FS_IN vec4 fragColor;\n"
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "FS_OUTPUT\n"
+    "void main() {\n"
+    "    float d = TEXTURE(texture0, fragTexCoord).a - 0.5;\n"
+    "    float w = length(vec2(dFdx(d), dFdy(d)));\n"
+    "    FS_COLOR = vec4(fragColor.rgb, fragColor.a * smoothstep(-w, w, d)) * colDiffuse;\n"
+    "}\n";
+
+/**
+ * The largest line thickness that a signed distance field shape can encode.
+ *
+ * @see raylib_nuklear_sdf_encode()
+ */
+#define RAYLIB_NUKLEAR_SDF_MAX_THICKNESS 254.0f
+
+/**
+ * Load one of the signed distance field shaders for the running OpenGL version.
+ *
+ * @param vsSource The vertex shader, without its version header.
+ * @param fsSource The fragment shader, without its version header.
+ *
+ * @return The shader, with an id of 0 when shaders are unsupported, like on OpenGL 1.1 and the software renderer.
+ *
+ * @internal
+ */
+static Shader
+raylib_nuklear_load_sdf_shader(const char* vsSource, const char* fsSource)
+{
+    const char* vsHeader;
+    const char* fsHeader;
+    switch (rlGetVersion()) {
+        case RL_OPENGL_21:
+            vsHeader = "#version 120\n#define VS_IN attribute\n#define VS_OUT varying\n";
+            fsHeader = "#version 120\n#define FS_IN varying\n#define FS_OUTPUT\n#define FS_COLOR gl_FragColor\n#define TEXTURE texture2D\n";
+            break;
+        case RL_OPENGL_33:
+        case RL_OPENGL_43:
+            vsHeader = "#version 330\n#define VS_IN in\n#define VS_OUT out\n";
+            fsHeader = "#version 330\n#define FS_IN in\n#define FS_OUTPUT out vec4 finalColor;\n#define FS_COLOR finalColor\n#define TEXTURE texture\n";
+            break;
+        case RL_OPENGL_ES_20:
+            vsHeader = "#version 100\n#define VS_IN attribute\n#define VS_OUT varying\n";
+            fsHeader = "#version 100\n#extension GL_OES_standard_derivatives : enable\n#ifdef GL_FRAGMENT_PRECISION_HIGH\nprecision highp float;\n#else\nprecision mediump float;\n#endif\n"
+                "#define FS_IN varying\n#define FS_OUTPUT\n#define FS_COLOR gl_FragColor\n#define TEXTURE texture2D\n";
+            break;
+        case RL_OPENGL_ES_30:
+            vsHeader = "#version 300 es\n#define VS_IN in\n#define VS_OUT out\n";
+            fsHeader = "#version 300 es\nprecision highp float;\n#define FS_IN in\n#define FS_OUTPUT out vec4 finalColor;\n#define FS_COLOR finalColor\n#define TEXTURE texture\n";
+            break;
+        default:
+            return CLITERAL(Shader) {0};
+    }
+
+    size_t vsHeaderLength = TextLength(vsHeader);
+    size_t fsHeaderLength = TextLength(fsHeader);
+    char* vs = (char*)MemAlloc((unsigned int)(vsHeaderLength + TextLength(vsSource) + 1));
+    char* fs = (char*)MemAlloc((unsigned int)(fsHeaderLength + TextLength(fsSource) + 1));
+    Shader shader = {0};
+    if (vs != NULL && fs != NULL) {
+        TextCopy(vs, vsHeader);
+        TextCopy(vs + vsHeaderLength, vsSource);
+        TextCopy(fs, fsHeader);
+        TextCopy(fs + fsHeaderLength, fsSource);
+        shader = LoadShaderFromMemory(vs, fs);
+
+        // raylib falls back to its default shader when compiling fails.
+        if (shader.id == rlGetShaderIdDefault()) {
+            shader = CLITERAL(Shader) {0};
+        }
+    }
+    MemFree(vs);
+    MemFree(fs);
+
+    return shader;
+}
+
+/**
+ * Get the shader for signed distance field fonts, loading it the first time.
+ *
+ * @return The shader, or NULL when shaders are unavailable.
+ *
+ * @internal
+ */
+static const Shader*
+raylib_nuklear_get_sdf_text_shader(void)
+{
+    if (!raylib_nuklear_sdf_text_shader_loaded) {
+        raylib_nuklear_sdf_text_shader_loaded = true;
+        raylib_nuklear_sdf_text_shader = raylib_nuklear_load_sdf_shader(raylib_nuklear_sdf_vs, raylib_nuklear_sdf_text_fs);
+        if (raylib_nuklear_sdf_text_shader.id == 0) {
+            TraceLog(LOG_WARNING, "NUKLEAR: Shaders are unavailable, drawing SDF fonts without the SDF text shader");
+        }
+    }
+    return (raylib_nuklear_sdf_text_shader.id != 0) ? &raylib_nuklear_sdf_text_shader : NULL;
+}
+
+#ifdef RAYLIB_NUKLEAR_USE_VERTEX_BUFFER
+/**
+ * Get the shader to draw with the given texture, when it's the texture of a signed distance field font.
+ *
+ * @return The SDF text shader, or NULL when the texture isn't an SDF font's.
+ *
+ * @internal
+ */
+static const Shader*
+raylib_nuklear_sdf_text_shader_for(unsigned int texture)
+{
+    for (const NuklearFont* font = raylib_nuklear_sdf_fonts; font != NULL; font = font->nextSDF) {
+        if (font->font.texture.id == texture) {
+            return raylib_nuklear_get_sdf_text_shader();
+        }
+    }
+    return NULL;
+}
+#endif  // RAYLIB_NUKLEAR_USE_VERTEX_BUFFER
+
+/**
+ * Switch to the SDF text shader for drawing text of a signed distance field font, if it isn't active yet.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_begin_sdf_text(NuklearDrawState* state)
+{
+    if (!state->sdfText) {
+        const Shader* shader = raylib_nuklear_get_sdf_text_shader();
+        if (shader != NULL) {
+            BeginShaderMode(*shader);
+            state->sdfText = true;
+        }
+    }
+}
+
+/**
+ * Switch back from the SDF text shader to the shader that shapes are drawn with.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_end_sdf_text(NuklearDrawState* state)
+{
+    if (state->sdfText) {
+        if (state->sdfShader != NULL) {
+            BeginShaderMode(*state->sdfShader);
+        }
+        else {
+            EndShaderMode();
+        }
+        state->sdfText = false;
+    }
+}
+
+/**
+ * Encode the radius and line thickness of a signed distance field shape into a vertex z coordinate.
+ *
+ * The integer part holds the radius in quarter pixels, and the fraction holds the thickness, offset by half a step so
+ * that it never rounds into the integer part. A thickness of 0 fills the shape.
+ *
+ * @internal
+ */
+static float
+raylib_nuklear_sdf_encode(float radius, float thickness)
+{
+    thickness = NK_CLAMP(0.0f, thickness, RAYLIB_NUKLEAR_SDF_MAX_THICKNESS);
+    return 1.0f + floorf(NK_MAX(radius, 0.0f) * 4.0f + 0.5f) + (thickness + 0.5f) / 256.0f;
+}
+
+/**
+ * Emit a signed distance field vertex at the given offset from the shape's center.
+ *
+ * @param center The center of the shape.
+ * @param offset The offset from the center.
+ * @param inner Half the size of the shape, minus its radius: where the corner circles are centered.
+ * @param shape The encoded radius and thickness.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_sdf_vertex(Vector2 center, Vector2 offset, Vector2 inner, float shape)
+{
+    rlTexCoord2f(fabsf(offset.x) - inner.x, fabsf(offset.y) - inner.y);
+    rlVertex3f(center.x + offset.x, center.y + offset.y, shape);
+}
+
+/**
+ * Draw a rounded rectangle, circle or ring with the signed distance field shader.
+ *
+ * The distance is mirrored into each quadrant, so the shape is drawn as four quads, grown by a pixel for antialiasing.
+ *
+ * @param rect The rectangle.
+ * @param radius The rounding. Half of the size draws a circle.
+ * @param thickness The line thickness, or 0 to fill the shape.
+ * @param color The color.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_draw_sdf_rect(Rectangle rect, float radius, float thickness, Color color)
+{
+    Vector2 half = {rect.width * 0.5f, rect.height * 0.5f};
+    radius = NK_CLAMP(0.0f, radius, NK_MIN(half.x, half.y));
+    Vector2 center = {rect.x + half.x, rect.y + half.y};
+    Vector2 inner = {half.x - radius, half.y - radius};
+    Vector2 extent = {half.x + 1.0f, half.y + 1.0f};
+    float shape = raylib_nuklear_sdf_encode(radius, thickness);
+
+    raylib_nuklear_begin_shapes();
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        for (int quadrant = 0; quadrant < 4; quadrant++) {
+            float sx = (quadrant == 0 || quadrant == 3) ? 1.0f : -1.0f;
+            float sy = (quadrant < 2) ? 1.0f : -1.0f;
+            Vector2 a = {0.0f, 0.0f};
+            Vector2 b = {sx * extent.x, 0.0f};
+            Vector2 c = {sx * extent.x, sy * extent.y};
+            Vector2 d = {0.0f, sy * extent.y};
+
+            // Keep the triangles counter-clockwise on the screen.
+            if (sx * sy > 0.0f) {
+                Vector2 swap = b;
+                b = d;
+                d = swap;
+            }
+            raylib_nuklear_sdf_vertex(center, a, inner, shape);
+            raylib_nuklear_sdf_vertex(center, b, inner, shape);
+            raylib_nuklear_sdf_vertex(center, c, inner, shape);
+            raylib_nuklear_sdf_vertex(center, c, inner, shape);
+            raylib_nuklear_sdf_vertex(center, d, inner, shape);
+            raylib_nuklear_sdf_vertex(center, a, inner, shape);
+        }
+    raylib_nuklear_end_shapes();
+}
+
+/**
+ * Draw a filled or outlined circle sector with the signed distance field shader.
+ *
+ * The sector is a fan of a few triangles around the circle, split at each quarter turn so that the mirrored distance
+ * stays linear within each triangle.
+ *
+ * @param center The center of the circle.
+ * @param radius The radius.
+ * @param thickness The line thickness of the arc, or 0 to fill the sector.
+ * @param startAngle The starting angle, in radians.
+ * @param endAngle The ending angle, in radians.
+ * @param color The color.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_draw_sdf_arc(Vector2 center, float radius, float thickness, float startAngle, float endAngle, Color color)
+{
+    if (radius <= 0.0f || startAngle == endAngle) return;
+    if (endAngle < startAngle) {
+        float swap = startAngle;
+        startAngle = endAngle;
+        endAngle = swap;
+    }
+    endAngle = NK_MIN(endAngle, startAngle + 2.0f * PI);
+
+    // Triangles span at most an eighth turn, so the fan only needs to reach a little past the circle.
+    const float maxStep = PI * 0.25f;
+    const float reach = (radius + 1.0f) / cosf(maxStep * 0.5f);
+    const Vector2 inner = {0.0f, 0.0f};
+    const float shape = raylib_nuklear_sdf_encode(radius, thickness);
+
+    raylib_nuklear_begin_shapes();
+        rlColor4ub(color.r, color.g, color.b, color.a);
+        float angle = startAngle;
+        while (angle < endAngle) {
+            // Stop at the next quarter turn, or an eighth turn away.
+            float quarterTurn = (floorf(angle / (PI * 0.5f)) + 1.0f) * (PI * 0.5f);
+            float next = NK_MIN(NK_MIN(quarterTurn, angle + maxStep), endAngle);
+            if (next <= angle) break;
+
+            Vector2 a = {cosf(angle) * reach, sinf(angle) * reach};
+            Vector2 b = {cosf(next) * reach, sinf(next) * reach};
+            raylib_nuklear_sdf_vertex(center, inner, inner, shape);
+            raylib_nuklear_sdf_vertex(center, b, inner, shape);
+            raylib_nuklear_sdf_vertex(center, a, inner, shape);
+            angle = next;
+        }
+    raylib_nuklear_end_shapes();
+}
+
+/**
+ * A view that does not cull anything, for when the drawable area is unknown.
+ */
+#define RAYLIB_NUKLEAR_UNBOUNDED_VIEW CLITERAL(Rectangle) {-1000000.0f, -1000000.0f, 2000000.0f, 2000000.0f}
+
+/**
+ * Get the intersection of two rectangles, which has a size of zero when they don't overlap.
+ *
+ * @internal
+ */
+static Rectangle
+raylib_nuklear_intersect_rects(Rectangle a, Rectangle b)
+{
+    float x = NK_MAX(a.x, b.x);
+    float y = NK_MAX(a.y, b.y);
+    float width = NK_MIN(a.x + a.width, b.x + b.width) - x;
+    float height = NK_MIN(a.y + a.height, b.y + b.height) - y;
+    return CLITERAL(Rectangle) {x, y, NK_MAX(width, 0.0f), NK_MAX(height, 0.0f)};
+}
+
+/**
+ * Check whether the given matrix is the identity matrix.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_matrix_is_identity(Matrix m)
+{
+    return m.m0 == 1.0f && m.m5 == 1.0f && m.m10 == 1.0f && m.m15 == 1.0f &&
+        m.m1 == 0.0f && m.m2 == 0.0f && m.m3 == 0.0f && m.m4 == 0.0f &&
+        m.m6 == 0.0f && m.m7 == 0.0f && m.m8 == 0.0f && m.m9 == 0.0f &&
+        m.m11 == 0.0f && m.m12 == 0.0f && m.m13 == 0.0f && m.m14 == 0.0f;
+}
+
+/**
+ * Get the drawable area of the current framebuffer, for culling commands that are off screen.
+ *
+ * Drawing within BeginMode2D(), or with any other transform, could move commands onto the screen, so nothing is
+ * culled in that case.
+ *
+ * @internal
+ */
+static Rectangle
+raylib_nuklear_get_view(void)
+{
+    if (!raylib_nuklear_matrix_is_identity(rlGetMatrixModelview()) || !raylib_nuklear_matrix_is_identity(rlGetMatrixTransform())) {
+        return RAYLIB_NUKLEAR_UNBOUNDED_VIEW;
+    }
+
+    return CLITERAL(Rectangle) {0.0f, 0.0f, (float)rlGetFramebufferWidth(), (float)rlGetFramebufferHeight()};
+}
+
+/**
+ * Get the bounding box of a list of points, grown by the given thickness.
+ *
+ * @internal
+ */
+static Rectangle
+raylib_nuklear_points_bounds(const struct nk_vec2i *points, int count, float thickness, float scale)
+{
+    if (count <= 0) {
+        return CLITERAL(Rectangle) {0.0f, 0.0f, 0.0f, 0.0f};
+    }
+
+    short minX = points[0].x, minY = points[0].y, maxX = points[0].x, maxY = points[0].y;
+    for (int i = 1; i < count; i++) {
+        minX = NK_MIN(minX, points[i].x);
+        minY = NK_MIN(minY, points[i].y);
+        maxX = NK_MAX(maxX, points[i].x);
+        maxY = NK_MAX(maxY, points[i].y);
+    }
+
+    return CLITERAL(Rectangle) {
+        ((float)minX - thickness) * scale,
+        ((float)minY - thickness) * scale,
+        ((float)(maxX - minX) + thickness * 2.0f) * scale,
+        ((float)(maxY - minY) + thickness * 2.0f) * scale
+    };
+}
+
+/**
+ * Get the scaled screen bounds that a Nuklear command draws within.
+ *
+ * @param cmd The command.
+ * @param scale The scaling of the Nuklear context.
+ * @param bounds Where to store the bounds.
+ *
+ * @return False when the command has no bounds, and should never be culled.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_command_bounds(const struct nk_command *cmd, float scale, Rectangle *bounds)
+{
+    switch (cmd->type) {
+        case NK_COMMAND_LINE: {
+            const struct nk_command_line *l = (const struct nk_command_line *)cmd;
+            struct nk_vec2i points[2] = {l->begin, l->end};
+            *bounds = raylib_nuklear_points_bounds(points, 2, (float)l->line_thickness, scale);
+        } return true;
+
+        case NK_COMMAND_CURVE: {
+            // A cubic bezier curve lies within the bounding box of its control points.
+            const struct nk_command_curve *q = (const struct nk_command_curve *)cmd;
+            struct nk_vec2i points[4] = {q->begin, q->ctrl[0], q->ctrl[1], q->end};
+            *bounds = raylib_nuklear_points_bounds(points, 4, (float)q->line_thickness, scale);
+        } return true;
+
+        case NK_COMMAND_RECT: {
+            const struct nk_command_rect *r = (const struct nk_command_rect *)cmd;
+            *bounds = CLITERAL(Rectangle) {(float)r->x * scale, (float)r->y * scale, (float)r->w * scale, (float)r->h * scale};
+        } return true;
+
+        case NK_COMMAND_RECT_FILLED: {
+            const struct nk_command_rect_filled *r = (const struct nk_command_rect_filled *)cmd;
+            *bounds = CLITERAL(Rectangle) {(float)r->x * scale, (float)r->y * scale, (float)r->w * scale, (float)r->h * scale};
+        } return true;
+
+        case NK_COMMAND_RECT_MULTI_COLOR: {
+            const struct nk_command_rect_multi_color *r = (const struct nk_command_rect_multi_color *)cmd;
+            *bounds = CLITERAL(Rectangle) {(float)r->x * scale, (float)r->y * scale, (float)r->w * scale, (float)r->h * scale};
+        } return true;
+
+        case NK_COMMAND_CIRCLE: {
+            const struct nk_command_circle *c = (const struct nk_command_circle *)cmd;
+            *bounds = CLITERAL(Rectangle) {(float)c->x * scale, (float)c->y * scale, (float)c->w * scale, (float)c->h * scale};
+        } return true;
+
+        case NK_COMMAND_CIRCLE_FILLED: {
+            const struct nk_command_circle_filled *c = (const struct nk_command_circle_filled *)cmd;
+            *bounds = CLITERAL(Rectangle) {(float)c->x * scale, (float)c->y * scale, (float)c->w * scale, (float)c->h * scale};
+        } return true;
+
+        case NK_COMMAND_ARC: {
+            const struct nk_command_arc *a = (const struct nk_command_arc *)cmd;
+            *bounds = CLITERAL(Rectangle) {((float)a->cx - (float)a->r) * scale, ((float)a->cy - (float)a->r) * scale, (float)a->r * 2.0f * scale, (float)a->r * 2.0f * scale};
+        } return true;
+
+        case NK_COMMAND_ARC_FILLED: {
+            const struct nk_command_arc_filled *a = (const struct nk_command_arc_filled *)cmd;
+            *bounds = CLITERAL(Rectangle) {((float)a->cx - (float)a->r) * scale, ((float)a->cy - (float)a->r) * scale, (float)a->r * 2.0f * scale, (float)a->r * 2.0f * scale};
+        } return true;
+
+        case NK_COMMAND_TRIANGLE: {
+            const struct nk_command_triangle *t = (const struct nk_command_triangle *)cmd;
+            struct nk_vec2i points[3] = {t->a, t->b, t->c};
+            *bounds = raylib_nuklear_points_bounds(points, 3, (float)t->line_thickness, scale);
+        } return true;
+
+        case NK_COMMAND_TRIANGLE_FILLED: {
+            const struct nk_command_triangle_filled *t = (const struct nk_command_triangle_filled *)cmd;
+            struct nk_vec2i points[3] = {t->a, t->b, t->c};
+            *bounds = raylib_nuklear_points_bounds(points, 3, 0.0f, scale);
+        } return true;
+
+        case NK_COMMAND_POLYGON: {
+            const struct nk_command_polygon *p = (const struct nk_command_polygon *)cmd;
+            *bounds = raylib_nuklear_points_bounds(p->points, p->point_count, (float)p->line_thickness, scale);
+        } return true;
+
+        case NK_COMMAND_POLYGON_FILLED: {
+            const struct nk_command_polygon_filled *p = (const struct nk_command_polygon_filled *)cmd;
+            *bounds = raylib_nuklear_points_bounds(p->points, p->point_count, 0.0f, scale);
+        } return true;
+
+        case NK_COMMAND_POLYLINE: {
+            const struct nk_command_polyline *p = (const struct nk_command_polyline *)cmd;
+            *bounds = raylib_nuklear_points_bounds(p->points, p->point_count, (float)p->line_thickness, scale);
+        } return true;
+
+        case NK_COMMAND_TEXT: {
+            // raylib's text spacing can differ slightly from Nuklear's measurement, so allow some overhang.
+            const struct nk_command_text *t = (const struct nk_command_text *)cmd;
+            *bounds = CLITERAL(Rectangle) {(float)t->x * scale, (float)t->y * scale, ((float)t->w + (float)t->h) * scale, (float)t->h * scale};
+        } return true;
+
+        case NK_COMMAND_IMAGE: {
+            const struct nk_command_image *i = (const struct nk_command_image *)cmd;
+            *bounds = CLITERAL(Rectangle) {(float)i->x * scale, (float)i->y * scale, (float)i->w * scale, (float)i->h * scale};
+        } return true;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * Copy an image into an atlas page at the given position. Both need to be R8G8B8A8.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_atlas_blit(NuklearAtlasPage* page, Image image, int x, int y)
+{
+    unsigned char* pixels = (unsigned char*)page->image.data;
+    const unsigned char* source = (const unsigned char*)image.data;
+    for (int row = 0; row < image.height; row++) {
+        nk_memcopy(pixels + ((size_t)(y + row) * (size_t)page->image.width + (size_t)x) * 4,
+            source + (size_t)row * (size_t)image.width * 4, (nk_size)image.width * 4);
+    }
+    page->changed = true;
+}
+
+/**
+ * Find room for an image in the atlas with a shelf packer, leaving a pixel of padding around it, and copy it there.
+ *
+ * @return True when the image was packed, false when the atlas is full.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_atlas_pack(NuklearAtlas* atlas, Image image, int* page, Rectangle* region)
+{
+    const int width = image.width + 1;
+    const int height = image.height + 1;
+    if (image.data == NULL || width > RAYLIB_NUKLEAR_ATLAS_SIZE || height > RAYLIB_NUKLEAR_ATLAS_SIZE) {
+        return false;
+    }
+
+    for (int i = 0; i < RAYLIB_NUKLEAR_ATLAS_PAGES; i++) {
+        if (i == atlas->pageCount) {
+            NuklearAtlasPage* added = &atlas->pages[i];
+            added->image = GenImageColor(RAYLIB_NUKLEAR_ATLAS_SIZE, RAYLIB_NUKLEAR_ATLAS_SIZE, BLANK);
+            if (added->image.data == NULL) {
+                return false;
+            }
+            added->texture = LoadTextureFromImage(added->image);
+            if (added->texture.id == 0) {
+                UnloadImage(added->image);
+                return false;
+            }
+            added->shelfX = added->shelfY = added->shelfHeight = 0;
+            added->changed = false;
+            atlas->pageCount++;
+        }
+
+        NuklearAtlasPage* current = &atlas->pages[i];
+        if (current->shelfX + width > RAYLIB_NUKLEAR_ATLAS_SIZE) {
+            // Start a new shelf below the current one.
+            current->shelfX = 0;
+            current->shelfY += current->shelfHeight;
+            current->shelfHeight = 0;
+        }
+        if (current->shelfY + height > RAYLIB_NUKLEAR_ATLAS_SIZE) {
+            continue;
+        }
+
+        raylib_nuklear_atlas_blit(current, image, current->shelfX, current->shelfY);
+        *page = i;
+        *region = CLITERAL(Rectangle) {(float)current->shelfX, (float)current->shelfY, (float)image.width, (float)image.height};
+        current->shelfX += width;
+        current->shelfHeight = NK_MAX(current->shelfHeight, height);
+        return true;
+    }
+
+    return false;
+}
+
+/**
+ * Load a copy of the given texture's pixels as R8G8B8A8, for packing into the atlas.
+ *
+ * @internal
+ */
+static Image
+raylib_nuklear_atlas_load_image(Texture2D texture)
+{
+    Image image = LoadImageFromTexture(texture);
+    if (image.data != NULL && image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8) {
+        ImageFormat(&image, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8);
+    }
+    if (image.data != NULL && (image.format != PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 || image.mipmaps != 1)) {
+        UnloadImage(image);
+        image = CLITERAL(Image) {0};
+    }
+    return image;
+}
+
+/**
+ * Clear the atlas and pack everything that's in use again: the white texel for shapes, the font, and the registered
+ * textures that were drawn recently or are waiting to be packed. Textures that went unused are evicted.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_atlas_repack(NuklearAtlas* atlas)
+{
+    for (int i = 0; i < atlas->pageCount; i++) {
+        NuklearAtlasPage* page = &atlas->pages[i];
+        nk_memset(page->image.data, 0, (nk_size)page->image.width * (nk_size)page->image.height * 4);
+        page->shelfX = page->shelfY = page->shelfHeight = 0;
+        page->changed = true;
+    }
+
+    // A white block, sampled from its center so that filtering never reaches its neighbours.
+    unsigned char white[3 * 3 * 4];
+    nk_memset(white, 255, sizeof(white));
+    Image whiteImage = {white, 3, 3, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+    int page;
+    Rectangle region;
+    atlas->white = CLITERAL(Rectangle) {0};
+    if (raylib_nuklear_atlas_pack(atlas, whiteImage, &page, &region)) {
+        atlas->white = CLITERAL(Rectangle) {region.x + 1.0f, region.y + 1.0f, 1.0f, 1.0f};
+    }
+
+    // The font keeps its own layout, offset to where it was packed.
+    atlas->font.texture = CLITERAL(Texture2D) {0};
+    if (atlas->fontImage.data != NULL && raylib_nuklear_atlas_pack(atlas, atlas->fontImage, &page, &region)) {
+        for (int i = 0; i < atlas->font.glyphCount; i++) {
+            atlas->font.recs[i].x += region.x - atlas->fontRegion.x;
+            atlas->font.recs[i].y += region.y - atlas->fontRegion.y;
+        }
+        atlas->fontRegion = region;
+        atlas->font.texture = atlas->pages[page].texture;
+    }
+
+    for (int i = 0; i < atlas->imageCount; i++) {
+        NuklearAtlasImage* image = &atlas->images[i];
+        image->page = -1;
+        if (image->wanted || atlas->frame - image->frame <= RAYLIB_NUKLEAR_ATLAS_EVICT_FRAMES) {
+            if (raylib_nuklear_atlas_pack(atlas, image->image, &page, &region)) {
+                image->page = page;
+                image->region = region;
+            }
+        }
+        image->wanted = false;
+    }
+    atlas->repackFrame = atlas->frame;
+}
+
+/**
+ * Unload the atlas's copy of the font.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_atlas_unload_font(NuklearAtlas* atlas)
+{
+    if (atlas->fontImage.data != NULL) {
+        UnloadImage(atlas->fontImage);
+    }
+    MemFree(atlas->font.recs);
+    atlas->fontImage = CLITERAL(Image) {0};
+    atlas->font = CLITERAL(Font) {0};
+    atlas->fontRegion = CLITERAL(Rectangle) {0};
+}
+
+/**
+ * Bring the atlas up to date before drawing a frame: pick up a changed font, pack the textures that were drawn without
+ * being in the atlas, and upload the pages that changed.
+ *
+ * Packing only happens here, so the regions that commands are drawn from stay the same throughout a frame.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_atlas_update(struct nk_context * ctx, NuklearAtlas* atlas, unsigned int frame)
+{
+    atlas->frame = frame;
+    bool repack = false;
+
+    // Pack the context's font, when it changed.
+    const struct nk_user_font* userFont = ctx->style.font;
+    const void* source = (userFont != NULL) ? userFont->userdata.ptr : NULL;
+    Font defaultFont = GetFontDefault();
+    const Font* font = (source != NULL) ? (const Font*)source : ((userFont != NULL) ? &defaultFont : NULL);
+    if (source != NULL && (((const NuklearFont*)source)->dynamic != NULL || ((const NuklearFont*)source)->sdf)) {
+        // Dynamic fonts keep changing their own glyph atlas, and SDF fonts need their own shader.
+        font = NULL;
+    }
+    unsigned int sourceTexture = (font != NULL) ? font->texture.id : 0;
+    if (atlas->pageCount == 0 || source != atlas->source || sourceTexture != atlas->sourceTexture) {
+        raylib_nuklear_atlas_unload_font(atlas);
+        atlas->source = source;
+        atlas->sourceTexture = sourceTexture;
+        if (sourceTexture != 0 && font->glyphCount > 0 && font->recs != NULL) {
+            atlas->font = *font;
+            atlas->font.recs = (Rectangle*)MemAlloc((unsigned int)((size_t)font->glyphCount * sizeof(Rectangle)));
+            if (atlas->font.recs != NULL) {
+                nk_memcopy(atlas->font.recs, font->recs, (nk_size)font->glyphCount * sizeof(Rectangle));
+                atlas->fontImage = raylib_nuklear_atlas_load_image(font->texture);
+            }
+            if (atlas->fontImage.data == NULL) {
+                raylib_nuklear_atlas_unload_font(atlas);
+            }
+        }
+        repack = true;
+    }
+
+    // Append the textures that were drawn without being in the atlas, or repack to evict unused ones when it's full.
+    // Repacking isn't attempted more often than textures can become unused, so a full atlas doesn't repack every frame.
+    if (!repack && atlas->dirty) {
+        for (int i = 0; i < atlas->imageCount && !repack; i++) {
+            NuklearAtlasImage* image = &atlas->images[i];
+            if (image->wanted && image->page < 0 && !raylib_nuklear_atlas_pack(atlas, image->image, &image->page, &image->region)) {
+                repack = frame - atlas->repackFrame > RAYLIB_NUKLEAR_ATLAS_EVICT_FRAMES;
+            }
+        }
+    }
+    atlas->dirty = false;
+
+    if (repack) {
+        raylib_nuklear_atlas_repack(atlas);
+    }
+    else {
+        for (int i = 0; i < atlas->imageCount; i++) {
+            atlas->images[i].wanted = false;
+        }
+    }
+
+    for (int i = 0; i < atlas->pageCount; i++) {
+        if (atlas->pages[i].changed) {
+            UpdateTexture(atlas->pages[i].texture, atlas->pages[i].image.data);
+            atlas->pages[i].changed = false;
+        }
+    }
+}
+
+/**
+ * Find the atlas entry of the given texture.
+ *
+ * @return The entry, or NULL when the texture isn't registered.
+ *
+ * @internal
+ */
+static NuklearAtlasImage*
+raylib_nuklear_atlas_find(NuklearAtlas* atlas, unsigned int texture)
+{
+    if (atlas == NULL || texture == 0) {
+        return NULL;
+    }
+    for (int i = 0; i < atlas->imageCount; i++) {
+        if (atlas->images[i].texture == texture) {
+            return &atlas->images[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * Draw text with a dynamic font, placing glyphs like DrawTextEx() and rasterizing the ones it doesn't have yet.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_draw_dynamic_text(NuklearFont* font, const char* text, int len, Vector2 position, float fontSize, float spacing, Color color)
+{
+    raylib_nuklear_dynamic_font_require(font, text, len);
+
+    // Upload new glyphs before drawing them, as scissor changes flush the batch before the end of the frame.
+    raylib_nuklear_dynamic_font_upload(font->dynamic);
+
+    const float scaleFactor = fontSize / (float)font->font.baseSize;
+    const float padding = (float)font->font.glyphPadding;
+    Vector2 offset = {0.0f, 0.0f};
+    for (int i = 0; i < len;) {
+        int codepoint = raylib_nuklear_next_codepoint(text, len, &i);
+        if (codepoint == '\n') {
+            // raylib's default line spacing.
+            offset.x = 0.0f;
+            offset.y += fontSize + 2.0f;
+            continue;
+        }
+
+        int index = raylib_nuklear_glyph_index(&font->font, &font->advances, codepoint);
+        if (index >= font->font.glyphCount) {
+            continue;
+        }
+        const Rectangle rec = font->font.recs[index];
+        const GlyphInfo* glyph = &font->font.glyphs[index];
+        if (codepoint != ' ' && codepoint != '\t' && font->dynamic->glyphPages[index] >= 0) {
+            Rectangle source = {rec.x - padding, rec.y - padding, rec.width + 2.0f * padding, rec.height + 2.0f * padding};
+            Rectangle dest = {
+                position.x + offset.x + ((float)glyph->offsetX - padding) * scaleFactor,
+                position.y + offset.y + ((float)glyph->offsetY - padding) * scaleFactor,
+                source.width * scaleFactor,
+                source.height * scaleFactor
+            };
+            DrawTexturePro(font->font.texture, source, dest, CLITERAL(Vector2) {0.0f, 0.0f}, 0.0f, color);
+        }
+        offset.x += ((glyph->advanceX == 0) ? rec.width : (float)glyph->advanceX) * scaleFactor + spacing;
+    }
+}
+
+/**
+ * Unload the text runs of the given cache.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_unload_text_runs(NuklearTextRunCache* cache)
+{
+    for (int i = 0; i < cache->count; i++) {
+        MemFree(cache->runs[i].quads);
+    }
+    MemFree(cache->runs);
+    MemFree(cache->slots);
+    *cache = CLITERAL(NuklearTextRunCache) {0};
+}
+
+/**
+ * Fill the hash table of the text run cache again, growing it when it's getting full.
+ *
+ * @return False when the hash table couldn't be allocated.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_rehash_text_runs(NuklearTextRunCache* cache)
+{
+    int slotCount = (cache->slotCount == 0) ? 64 : cache->slotCount;
+    while (slotCount < cache->count * 2) {
+        slotCount *= 2;
+    }
+    if (slotCount != cache->slotCount) {
+        int* slots = (int*)MemRealloc(cache->slots, (unsigned int)((size_t)slotCount * sizeof(int)));
+        if (slots == NULL) {
+            return false;
+        }
+        cache->slots = slots;
+        cache->slotCount = slotCount;
+    }
+
+    nk_memset(cache->slots, 0, (nk_size)cache->slotCount * sizeof(int));
+    unsigned int mask = (unsigned int)cache->slotCount - 1;
+    for (int i = 0; i < cache->count; i++) {
+        unsigned int slot = (unsigned int)cache->runs[i].hash & mask;
+        while (cache->slots[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        cache->slots[slot] = i + 1;
+    }
+    return true;
+}
+
+/**
+ * Unload the text runs that weren't drawn in the current frame.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_evict_text_runs(NuklearTextRunCache* cache)
+{
+    int count = cache->count;
+    for (int i = cache->count - 1; i >= 0; i--) {
+        if (cache->runs[i].frame != cache->frame) {
+            MemFree(cache->runs[i].quads);
+            cache->runs[i] = cache->runs[--cache->count];
+        }
+    }
+    if (cache->count != count && !raylib_nuklear_rehash_text_runs(cache)) {
+        raylib_nuklear_unload_text_runs(cache);
+    }
+}
+
+/**
+ * Get the glyph quads of the given text from the text run cache, laying the glyphs out like DrawTextEx() when the text
+ * wasn't drawn in the previous frame.
+ *
+ * @return The text run, or NULL when it couldn't be allocated.
+ *
+ * @internal
+ */
+static const NuklearTextRun*
+raylib_nuklear_get_text_run(NuklearTextRunCache* cache, const Font* font, const NuklearGlyphAdvances* advances, const char* text, int len, float fontSize, float spacing)
+{
+    // The texture alone doesn't tell fonts apart, as fonts in the texture atlas share its pages.
+    struct {
+        const GlyphInfo* glyphs;
+        unsigned int texture;
+        float fontSize;
+        float spacing;
+        int glyphCount;
+    } key = {font->glyphs, font->texture.id, fontSize, spacing, font->glyphCount};
+    unsigned long long hash = raylib_nuklear_hash(text, (size_t)len, RAYLIB_NUKLEAR_HASH_SEED);
+    hash = raylib_nuklear_hash(&key, sizeof(key), hash);
+
+    if (cache->slotCount > 0) {
+        unsigned int mask = (unsigned int)cache->slotCount - 1;
+        for (unsigned int slot = (unsigned int)hash & mask; cache->slots[slot] != 0; slot = (slot + 1) & mask) {
+            NuklearTextRun* run = &cache->runs[cache->slots[slot] - 1];
+            if (run->hash == hash && run->length == len && run->glyphs == key.glyphs && run->glyphCount == key.glyphCount &&
+                    run->texture == key.texture && run->fontSize == fontSize && run->spacing == spacing) {
+                run->frame = cache->frame;
+                return run;
+            }
+        }
+    }
+
+    if (cache->count == cache->capacity) {
+        int capacity = (cache->capacity == 0) ? 64 : cache->capacity * 2;
+        NuklearTextRun* runs = (NuklearTextRun*)MemRealloc(cache->runs, (unsigned int)((size_t)capacity * sizeof(NuklearTextRun)));
+        if (runs == NULL) {
+            return NULL;
+        }
+        cache->runs = runs;
+        cache->capacity = capacity;
+    }
+    NuklearGlyphQuad* quads = (NuklearGlyphQuad*)MemAlloc((unsigned int)((size_t)len * sizeof(NuklearGlyphQuad)));
+    if (quads == NULL) {
+        return NULL;
+    }
+
+    // Place the glyphs the same way as DrawTextEx() and DrawTextCodepoint().
+    const float scaleFactor = fontSize / (float)font->baseSize;
+    const float padding = (float)font->glyphPadding;
+    Vector2 offset = {0.0f, 0.0f};
+    int quadCount = 0;
+    for (int i = 0; i < len;) {
+        int codepoint = raylib_nuklear_next_codepoint(text, len, &i);
+        if (codepoint == '\n') {
+            // raylib's default line spacing.
+            offset.x = 0.0f;
+            offset.y += fontSize + 2.0f;
+            continue;
+        }
+
+        int index = raylib_nuklear_glyph_index(font, advances, codepoint);
+        if (index < 0 || index >= font->glyphCount) {
+            continue;
+        }
+        const Rectangle rec = font->recs[index];
+        const GlyphInfo* glyph = &font->glyphs[index];
+        if (codepoint != ' ' && codepoint != '\t') {
+            quads[quadCount].index = index;
+            quads[quadCount].dest = CLITERAL(Rectangle) {
+                offset.x + ((float)glyph->offsetX - padding) * scaleFactor,
+                offset.y + ((float)glyph->offsetY - padding) * scaleFactor,
+                (rec.width + 2.0f * padding) * scaleFactor,
+                (rec.height + 2.0f * padding) * scaleFactor
+            };
+            quadCount++;
+        }
+        offset.x += ((glyph->advanceX == 0) ? rec.width : (float)glyph->advanceX) * scaleFactor + spacing;
+    }
+
+    NuklearTextRun* run = &cache->runs[cache->count++];
+    run->hash = hash;
+    run->glyphs = key.glyphs;
+    run->glyphCount = key.glyphCount;
+    run->texture = key.texture;
+    run->fontSize = fontSize;
+    run->spacing = spacing;
+    run->length = len;
+    run->quads = quads;
+    run->quadCount = quadCount;
+    run->frame = cache->frame;
+
+    if (cache->count * 2 > cache->slotCount) {
+        if (!raylib_nuklear_rehash_text_runs(cache)) {
+            MemFree(quads);
+            cache->count--;
+            return NULL;
+        }
+    }
+    else {
+        unsigned int mask = (unsigned int)cache->slotCount - 1;
+        unsigned int slot = (unsigned int)hash & mask;
+        while (cache->slots[slot] != 0) {
+            slot = (slot + 1) & mask;
+        }
+        cache->slots[slot] = cache->count;
+    }
+    return run;
+}
+
+/**
+ * Draw text like DrawTextEx(), from the text run cache when there is one, skipping the glyphs outside the clip rectangle.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_draw_text(NuklearDrawState* state, const Font* font, const NuklearGlyphAdvances* advances, const char* text, int len, Vector2 position, float fontSize, float spacing, Color color)
+{
+    const NuklearTextRun* run = NULL;
+    if (state->textRuns != NULL && font->texture.id != 0 && font->baseSize > 0 && len > 0) {
+        run = raylib_nuklear_get_text_run(state->textRuns, font, advances, text, len, fontSize, spacing);
+    }
+    if (run == NULL) {
+        DrawTextEx(*font, text, position, fontSize, spacing, color);
+        return;
+    }
+
+    // Submit the glyph quads the same way as DrawTexturePro(), in one batch for the whole text.
+    const Rectangle clip = state->clip;
+    const float padding = (float)font->glyphPadding;
+    const float width = (float)font->texture.width;
+    const float height = (float)font->texture.height;
+    rlSetTexture(font->texture.id);
+    rlBegin(RL_QUADS);
+    rlColor4ub(color.r, color.g, color.b, color.a);
+    rlNormal3f(0.0f, 0.0f, 1.0f);
+    for (int i = 0; i < run->quadCount; i++) {
+        const NuklearGlyphQuad* quad = &run->quads[i];
+        if (quad->index >= font->glyphCount) {
+            continue;
+        }
+        Rectangle dest = {position.x + quad->dest.x, position.y + quad->dest.y, quad->dest.width, quad->dest.height};
+        if (dest.x > clip.x + clip.width + 1.0f || dest.x + dest.width < clip.x - 1.0f ||
+                dest.y > clip.y + clip.height + 1.0f || dest.y + dest.height < clip.y - 1.0f) {
+            state->stats->culledGlyphs++;
+            continue;
+        }
+
+        const Rectangle rec = font->recs[quad->index];
+        const float left = (rec.x - padding) / width;
+        const float top = (rec.y - padding) / height;
+        const float right = (rec.x + rec.width + padding) / width;
+        const float bottom = (rec.y + rec.height + padding) / height;
+        rlTexCoord2f(left, top);
+        rlVertex2f(dest.x, dest.y);
+        rlTexCoord2f(left, bottom);
+        rlVertex2f(dest.x, dest.y + dest.height);
+        rlTexCoord2f(right, bottom);
+        rlVertex2f(dest.x + dest.width, dest.y + dest.height);
+        rlTexCoord2f(right, top);
+        rlVertex2f(dest.x + dest.width, dest.y);
+    }
+    rlEnd();
+    rlSetTexture(0);
+}
+
+/**
+ * Note the texture that the next command is drawn with, counting texture switches.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_use_texture(NuklearDrawState* state, unsigned int texture)
+{
+    if (state->texture != texture) {
+        if (state->texture != 0) {
+            state->stats->textureSwitches++;
+        }
+        state->texture = texture;
+    }
+}
+
+/**
+ * Apply a Nuklear scissor command, skipping it when it matches the active scissor.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_draw_scissor(NuklearDrawState *state, const struct nk_command_scissor *s)
+{
+    // Nuklear disables clipping with a huge rectangle starting at -8192.
+    if (s->x <= -8000) {
+        if (!state->scissor) {
+            state->stats->skippedScissors++;
+            return;
+        }
+        EndScissorMode();
+        state->stats->batchFlushes++;
+        state->scissor = false;
+        state->clip = state->view;
+        return;
+    }
+
+    float scale = state->scale;
+    int rect[4] = {(int)(s->x * scale - state->origin.x), (int)(s->y * scale - state->origin.y), (int)(s->w * scale), (int)(s->h * scale)};
+    state->clip = raylib_nuklear_intersect_rects(state->view, CLITERAL(Rectangle) {(float)s->x * scale, (float)s->y * scale, (float)s->w * scale, (float)s->h * scale});
+    if (state->scissor && rect[0] == state->scissorRect[0] && rect[1] == state->scissorRect[1] &&
+            rect[2] == state->scissorRect[2] && rect[3] == state->scissorRect[3]) {
+        state->stats->skippedScissors++;
+        return;
+    }
+
+    BeginScissorMode(rect[0], rect[1], rect[2], rect[3]);
+    state->stats->batchFlushes++;
+    state->scissor = true;
+    for (int i = 0; i < 4; i++) {
+        state->scissorRect[i] = rect[i];
+    }
+}
+
+/**
+ * End the active scissor, if there is one.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_end_scissor(NuklearDrawState *state)
+{
+    if (state->scissor) {
+        EndScissorMode();
+        state->stats->batchFlushes++;
+        state->scissor = false;
+    }
+    state->clip = state->view;
+}
+
+/**
+ * Draw a single Nuklear command, unless it's outside of the active clip rectangle or the screen.
+ *
+ * @param ctx The nuklear context.
+ * @param cmd The command to draw.
+ * @param state The drawing state, with the scaling and the active clip rectangle.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_draw_command(struct nk_context * ctx, const struct nk_command *cmd, NuklearDrawState *state)
+{
+    const float scale = state->scale;
+
+    if (cmd->type == NK_COMMAND_SCISSOR) {
+        raylib_nuklear_draw_scissor(state, (const struct nk_command_scissor*)cmd);
+        return;
+    }
+
+    // Skip commands that can't be seen. Allow a pixel of tolerance for rounding.
+    Rectangle bounds;
+    if (raylib_nuklear_command_bounds(cmd, scale, &bounds)) {
+        const Rectangle clip = state->clip;
+        if (clip.width <= 0.0f || clip.height <= 0.0f ||
+                bounds.x > clip.x + clip.width + 1.0f || bounds.x + bounds.width < clip.x - 1.0f ||
+                bounds.y > clip.y + clip.height + 1.0f || bounds.y + bounds.height < clip.y - 1.0f) {
+            state->stats->culledCommands++;
+            return;
+        }
+    }
+
+    if (cmd->type != NK_COMMAND_NOP) {
+        state->stats->drawCalls++;
+    }
+    if (state->sdfText && (cmd->type != NK_COMMAND_TEXT || ((const struct nk_command_text*)cmd)->font->userdata.ptr == NULL ||
+            !((const NuklearFont*)((const struct nk_command_text*)cmd)->font->userdata.ptr)->sdf)) {
+        raylib_nuklear_end_sdf_text(state);
+    }
+    if (cmd->type != NK_COMMAND_NOP && cmd->type != NK_COMMAND_TEXT && cmd->type != NK_COMMAND_IMAGE && cmd->type != NK_COMMAND_CUSTOM) {
+        raylib_nuklear_use_texture(state, state->shapesTexture);
+    }
+
+    switch (cmd->type) {
+        case NK_COMMAND_NOP: {
+            break;
+        }
+
+        case NK_COMMAND_LINE: {
+            const struct nk_command_line *l = (const struct nk_command_line *)cmd;
+            Color color = NuklearColorToColor(l->color);
+            Vector2 startPos = CLITERAL(Vector2) {(float)l->begin.x * scale, (float)l->begin.y * scale};
+            Vector2 endPos = CLITERAL(Vector2) {(float)l->end.x * scale, (float)l->end.y * scale};
+            DrawLineEx(startPos, endPos, l->line_thickness * scale, color);
+        } break;
+
+        case NK_COMMAND_CURVE: {
+            const struct nk_command_curve *q = (const struct nk_command_curve *)cmd;
+            Color color = NuklearColorToColor(q->color);
+            Vector2 begin = CLITERAL(Vector2) {(float)q->begin.x * scale, (float)q->begin.y * scale};
+            Vector2 controlPoint1 = CLITERAL(Vector2) {(float)q->ctrl[0].x * scale, (float)q->ctrl[0].y * scale};
+            Vector2 controlPoint2 = CLITERAL(Vector2) {(float)q->ctrl[1].x * scale, (float)q->ctrl[1].y * scale};
+            Vector2 end = CLITERAL(Vector2) {(float)q->end.x * scale, (float)q->end.y * scale};
+            raylib_nuklear_draw_curve(begin, controlPoint1, controlPoint2, end, (float)q->line_thickness * scale, color);
+        } break;
+
+        case NK_COMMAND_RECT: {
+            const struct nk_command_rect *r = (const struct nk_command_rect *)cmd;
+            Color color = NuklearColorToColor(r->color);
+            Rectangle rect = CLITERAL(Rectangle) {(float)r->x * scale, (float)r->y * scale, (float)r->w * scale, (float)r->h * scale};
+            // We manually draw the rectangle with rounding instead of using DrawRectangleEx(), as we have more control over the corners.
+            if (r->rounding > 0 && state->sdfShader != NULL) {
+                raylib_nuklear_draw_sdf_rect(rect, (float)r->rounding * scale, NK_MAX((float)r->line_thickness * scale, 1.0f), color);
+            }
+            else if (r->rounding > 0) {
+                float rad = NK_MIN((float)r->rounding * scale, NK_MIN(rect.width, rect.height) * 0.5f);
+                float thick = (float)r->line_thickness * scale;
+                // Straight edges
+                DrawRectangleRec((Rectangle){rect.x + rad, rect.y, rect.width - 2.0f * rad, thick}, color);
+                DrawRectangleRec((Rectangle){rect.x + rad, rect.y + rect.height - thick, rect.width - 2.0f * rad, thick}, color);
+                DrawRectangleRec((Rectangle){rect.x, rect.y + rad, thick, rect.height - 2.0f * rad}, color);
+                DrawRectangleRec((Rectangle){rect.x + rect.width - thick, rect.y + rad, thick, rect.height - 2.0f * rad}, color);
+                // Corner quarter-arc rings
+                raylib_nuklear_draw_ring_quarters((Vector2){rect.x + rad, rect.y + rad}, NK_MAX(rad - thick, 0.0f), rad, 2, 1, color);
+                raylib_nuklear_draw_ring_quarters((Vector2){rect.x + rect.width - rad,  rect.y + rad}, NK_MAX(rad - thick, 0.0f), rad, 3, 1, color);
+                raylib_nuklear_draw_ring_quarters((Vector2){rect.x + rect.width - rad, rect.y + rect.height - rad}, NK_MAX(rad - thick, 0.0f), rad, 0, 1, color);
+                raylib_nuklear_draw_ring_quarters((Vector2){rect.x + rad, rect.y + rect.height - rad}, NK_MAX(rad - thick, 0.0f), rad, 1, 1, color);
+            }
+            else {
+                DrawRectangleLinesEx(rect, r->line_thickness * scale, color);
+            }
+        } break;
+
+        case NK_COMMAND_RECT_FILLED: {
+            const struct nk_command_rect_filled *r = (const struct nk_command_rect_filled *)cmd;
+            Color color = NuklearColorToColor(r->color);
+            Rectangle rect = CLITERAL(Rectangle) {(float)r->x * scale, (float)r->y * scale, (float)r->w * scale, (float)r->h * scale};
+            // We manually draw the rectangle with rounding instead of using DrawRectangleEx(), as we have more control over the corners.
+            if (r->rounding > 0 && state->sdfShader != NULL) {
+                raylib_nuklear_draw_sdf_rect(rect, (float)r->rounding * scale, 0.0f, color);
+            }
+            else if (r->rounding > 0) {
+                float rad = NK_MIN((float)r->rounding * scale, NK_MIN(rect.width, rect.height) * 0.5f);
+                // Center vertical strip + top/bottom horizontal strips
+                DrawRectangleRec((Rectangle){rect.x, rect.y + rad, rect.width, rect.height - 2.0f * rad}, color);
+                DrawRectangleRec((Rectangle){rect.x + rad, rect.y, rect.width - 2.0f * rad, rad}, color);
+                DrawRectangleRec((Rectangle){rect.x + rad, rect.y + rect.height - rad, rect.width - 2.0f * rad, rad}, color);
+                // Corner quarter-circle arcs
+                raylib_nuklear_draw_ring_quarters((Vector2){rect.x + rad, rect.y + rad}, 0.0f, rad, 2, 1, color);
+                raylib_nuklear_draw_ring_quarters((Vector2){rect.x + rect.width - rad, rect.y + rad}, 0.0f, rad, 3, 1, color);
+                raylib_nuklear_draw_ring_quarters((Vector2){rect.x + rect.width - rad, rect.y + rect.height - rad}, 0.0f, rad, 0, 1, color);
+                raylib_nuklear_draw_ring_quarters((Vector2){rect.x + rad, rect.y + rect.height - rad}, 0.0f, rad, 1, 1, color);
+            }
+            else {
+                DrawRectangleRec(rect, color);
+            }
+        } break;
+
+        case NK_COMMAND_RECT_MULTI_COLOR: {
+            const struct nk_command_rect_multi_color* rectangle = (const struct nk_command_rect_multi_color *)cmd;
+            Rectangle position = {(float)rectangle->x * scale, (float)rectangle->y * scale, (float)rectangle->w * scale, (float)rectangle->h * scale};
+            // raylib's DrawRectangleGradientEx() takes corners in the order
+            // (topLeft, bottomLeft, bottomRight, topRight). Nuklear maps its
+            // rect_multi_color fields to corners as left=topLeft, top=topRight,
+            // right=bottomRight, bottom=bottomLeft (see nk_draw_list_fill_rect_multi_color).
+            DrawRectangleGradientEx(position,
+                NuklearColorToColor(rectangle->left),   // Top Left
+                NuklearColorToColor(rectangle->bottom), // Bottom Left
+                NuklearColorToColor(rectangle->right),  // Bottom Right
+                NuklearColorToColor(rectangle->top)     // Top Right
+            );
+        } break;
+
+        case NK_COMMAND_CIRCLE: {
+            const struct nk_command_circle *c = (const struct nk_command_circle *)cmd;
+            Color color = NuklearColorToColor(c->color);
+            float thick = NK_MAX((float)c->line_thickness * scale, 1.0f);
+            Rectangle rect = CLITERAL(Rectangle) {(float)c->x * scale, (float)c->y * scale, (float)c->w * scale, (float)c->h * scale};
+            if (c->w == c->h && state->sdfShader != NULL) {
+                raylib_nuklear_draw_sdf_rect(rect, rect.width * 0.5f, thick, color);
+            }
+            else {
+                Vector2 center = {rect.x + rect.width * 0.5f, rect.y + rect.height * 0.5f};
+                raylib_nuklear_draw_ellipse(center, rect.width * 0.5f, rect.height * 0.5f, thick, color);
+            }
+        } break;
+
+        case NK_COMMAND_CIRCLE_FILLED: {
+            const struct nk_command_circle_filled *c = (const struct nk_command_circle_filled *)cmd;
+            Color color = NuklearColorToColor(c->color);
+            Rectangle rect = CLITERAL(Rectangle) {(float)c->x * scale, (float)c->y * scale, (float)c->w * scale, (float)c->h * scale};
+            if (c->w == c->h && state->sdfShader != NULL) {
+                raylib_nuklear_draw_sdf_rect(rect, rect.width * 0.5f, 0.0f, color);
+            }
+            else {
+                Vector2 center = {rect.x + rect.width * 0.5f, rect.y + rect.height * 0.5f};
+                raylib_nuklear_draw_ellipse(center, rect.width * 0.5f, rect.height * 0.5f, 0.0f, color);
+            }
+        } break;
+
+        case NK_COMMAND_ARC: {
+            const struct nk_command_arc *a = (const struct nk_command_arc*)cmd;
+            Color color = NuklearColorToColor(a->color);
+            Vector2 center = CLITERAL(Vector2) {(float)a->cx * scale, (float)a->cy * scale};
+            float outerRadius = a->r * scale;
+            float thick = a->line_thickness * scale;
+            float innerRadius = outerRadius - thick;
+            if (innerRadius < 0.0f) innerRadius = 0.0f;
+            if (state->sdfShader != NULL) {
+                raylib_nuklear_draw_sdf_arc(center, outerRadius, NK_MAX(thick, 1.0f), a->a[0], a->a[1], color);
+            }
+            else {
+                raylib_nuklear_draw_arc(center, innerRadius, outerRadius, a->a[0], a->a[1], color);
+            }
+            Vector2 p0 = {center.x + outerRadius * cosf(a->a[0]), center.y + outerRadius * sinf(a->a[0])};
+            Vector2 p1 = {center.x + outerRadius * cosf(a->a[1]), center.y + outerRadius * sinf(a->a[1])};
+            DrawLineEx(center, p0, thick, color);
+            DrawLineEx(center, p1, thick, color);
+        } break;
+
+        case NK_COMMAND_ARC_FILLED: {
+            const struct nk_command_arc_filled *a = (const struct nk_command_arc_filled*)cmd;
+            Color color = NuklearColorToColor(a->color);
+            Vector2 center = CLITERAL(Vector2) {(float)a->cx * scale, (float)a->cy * scale};
+            if (state->sdfShader != NULL) {
+                raylib_nuklear_draw_sdf_arc(center, a->r * scale, 0.0f, a->a[0], a->a[1], color);
+            }
+            else {
+                raylib_nuklear_draw_arc(center, 0.0f, a->r * scale, a->a[0], a->a[1], color);
+            }
+        } break;
+
+        case NK_COMMAND_TRIANGLE: {
+            const struct nk_command_triangle *t = (const struct nk_command_triangle*)cmd;
+            Color color = NuklearColorToColor(t->color);
+            Vector2 point1 = CLITERAL(Vector2) {(float)t->b.x * scale, (float)t->b.y * scale};
+            Vector2 point2 = CLITERAL(Vector2) {(float)t->a.x * scale, (float)t->a.y * scale};
+            Vector2 point3 = CLITERAL(Vector2) {(float)t->c.x * scale, (float)t->c.y * scale};
+
+            DrawLineEx(point1, point2, t->line_thickness * scale, color);
+            DrawLineEx(point2, point3, t->line_thickness * scale, color);
+            DrawLineEx(point3, point1, t->line_thickness * scale, color);
+            // TODO: Add line thickness to DrawTriangleLines(), maybe via a DrawTriangleLinesEx()?
+            // DrawTriangleLines(point1, point2, point3, color);
+        } break;
+
+        case NK_COMMAND_TRIANGLE_FILLED: {
+            const struct nk_command_triangle_filled *t = (const struct nk_command_triangle_filled*)cmd;
+            Color color = NuklearColorToColor(t->color);
+            Vector2 point1 = CLITERAL(Vector2) {(float)t->b.x * scale, (float)t->b.y * scale};
+            Vector2 point2 = CLITERAL(Vector2) {(float)t->a.x * scale, (float)t->a.y * scale};
+            Vector2 point3 = CLITERAL(Vector2) {(float)t->c.x * scale, (float)t->c.y * scale};
+            DrawTriangle(point1, point2, point3, color);
+        } break;
+
+        case NK_COMMAND_POLYGON: {
+            const struct nk_command_polygon *p = (const struct nk_command_polygon*)cmd;
+            Color color = NuklearColorToColor(p->color);
+            float thickness = (float)p->line_thickness * scale;
+            for (unsigned short i = 0; i < p->point_count - 1; i++) {
+                Vector2 start = {(float)p->points[i].x * scale, (float)p->points[i].y * scale};
+                Vector2 end = {(float)p->points[i + 1].x * scale, (float)p->points[i + 1].y * scale};
+                DrawLineEx(start, end, thickness, color);
+            }
+            if (p->point_count >= 2) {
+                Vector2 last = {(float)p->points[p->point_count - 1].x * scale, (float)p->points[p->point_count - 1].y * scale};
+                Vector2 first = {(float)p->points[0].x * scale, (float)p->points[0].y * scale};
+                DrawLineEx(last, first, thickness, color);
+            }
+        } break;
+
+        case NK_COMMAND_POLYGON_FILLED: {
+            const struct nk_command_polygon_filled *p = (const struct nk_command_polygon_filled*)cmd;
+            raylib_nuklear_draw_polygon_fill((NuklearUserData*)ctx->userdata.ptr, scale, p->points, p->point_count, NuklearColorToColor(p->color));
+        } break;
+
+        case NK_COMMAND_POLYLINE: {
+            const struct nk_command_polyline *p = (const struct nk_command_polyline *)cmd;
+            Color color = NuklearColorToColor(p->color);
+            for (unsigned short i = 0; i < p->point_count - 1; i++) {
+                Vector2 start = {(float)p->points[i].x * scale, (float)p->points[i].y * scale};
+                Vector2 end = {(float)p->points[i + 1].x * scale, (float)p->points[i + 1].y * scale};
+                DrawLineEx(start, end, p->line_thickness * scale, color);
+            }
+        } break;
+
+        case NK_COMMAND_TEXT: {
+            const struct nk_command_text *text = (const struct nk_command_text*)cmd;
+            Color color = NuklearColorToColor(text->foreground);
+            float fontSize = text->font->height * scale;
+            Font* font = (Font*)text->font->userdata.ptr;
+            Font defaultFont = GetFontDefault();
+            if (state->atlas != NULL && state->atlas->font.texture.id != 0 && state->atlas->source == text->font->userdata.ptr) {
+                // Draw the glyphs from the atlas, laid out the same way as below.
+                Vector2 position = {(float)text->x * scale, (float)text->y * scale};
+                float spacing = fontSize * RAYLIB_NUKLEAR_FONT_SPACING_RATIO;
+                const NuklearGlyphAdvances* advances;
+                if (font == NULL) {
+                    // Match DrawText(), which rounds to whole pixels and spaces by a tenth of the size.
+                    position = CLITERAL(Vector2) {(float)(int)position.x, (float)(int)position.y};
+                    int size = NK_MAX((int)fontSize, 10);
+                    fontSize = (float)size;
+                    spacing = (float)(size / 10);
+                    advances = raylib_nuklear_get_default_font_advances(&defaultFont);
+                }
+                else {
+                    advances = &((NuklearFont*)font)->advances;
+                }
+                raylib_nuklear_use_texture(state, state->atlas->font.texture.id);
+                raylib_nuklear_draw_text(state, &state->atlas->font, advances, (const char*)text->string, text->length, position, fontSize, spacing, color);
+            }
+            else if (font != NULL) {
+                Vector2 position = {(float)text->x * scale, (float)text->y * scale};
+                raylib_nuklear_use_texture(state, font->texture.id);
+                if (((NuklearFont*)font)->sdf) {
+                    raylib_nuklear_begin_sdf_text(state);
+                }
+                if (((NuklearFont*)font)->dynamic != NULL) {
+                    raylib_nuklear_draw_dynamic_text((NuklearFont*)font, (const char*)text->string, text->length, position, fontSize, fontSize * RAYLIB_NUKLEAR_FONT_SPACING_RATIO, color);
+                }
+                else {
+                    raylib_nuklear_draw_text(state, font, &((NuklearFont*)font)->advances, (const char*)text->string, text->length, position, fontSize, fontSize * RAYLIB_NUKLEAR_FONT_SPACING_RATIO, color);
+                }
+            }
+            else {
+                // Match DrawText(), which rounds to whole pixels and spaces by a tenth of the size.
+                Vector2 position = {(float)(int)(text->x * scale), (float)(int)(text->y * scale)};
+                int size = NK_MAX((int)fontSize, 10);
+                raylib_nuklear_use_texture(state, defaultFont.texture.id);
+                raylib_nuklear_draw_text(state, &defaultFont, raylib_nuklear_get_default_font_advances(&defaultFont), (const char*)text->string, text->length, position, (float)size, (float)(size / 10), color);
+            }
+        } break;
+
+        case NK_COMMAND_IMAGE: {
+            const struct nk_command_image *i = (const struct nk_command_image *)cmd;
+            Texture texture = NuklearImageToTexture(i->img);
+            Rectangle source = CLITERAL(Rectangle) {(float)i->img.region[0], (float)i->img.region[1], (float)i->img.region[2], (float)i->img.region[3]};
+            NuklearAtlasImage* atlasImage = raylib_nuklear_atlas_find(state->atlas, texture.id);
+            if (atlasImage != NULL) {
+                atlasImage->frame = state->atlas->frame;
+                texture.width = atlasImage->image.width;
+                texture.height = atlasImage->image.height;
+            }
+            if (source.width <= 0 || source.height <= 0) {
+                // Images from nk_image_id(), nk_image_ptr() or nk_image_handle() have an empty region; use the full texture instead.
+                source.width = (i->img.w > 0) ? (float)i->img.w : (float)texture.width;
+                source.height = (i->img.h > 0) ? (float)i->img.h : (float)texture.height;
+                if (source.width <= 0 || source.height <= 0) {
+                    // The texture size is unknown (nk_image_id() only carries the id), so map the whole texture onto the destination.
+                    texture.width = 1;
+                    texture.height = 1;
+                    source.width = 1;
+                    source.height = 1;
+                }
+            }
+            if (atlasImage != NULL && atlasImage->page >= 0) {
+                // Images are looked up at draw time, so they keep working when the atlas is repacked.
+                texture = state->atlas->pages[atlasImage->page].texture;
+                source.x += atlasImage->region.x;
+                source.y += atlasImage->region.y;
+            }
+            else if (atlasImage != NULL) {
+                // Pack it before the next frame.
+                atlasImage->wanted = true;
+                state->atlas->dirty = true;
+            }
+            Rectangle dest = CLITERAL(Rectangle) {(float)i->x * scale, (float)i->y * scale, (float)i->w * scale, (float)i->h * scale};
+            Vector2 origin = CLITERAL(Vector2) {0, 0};
+            Color tint = NuklearColorToColor(i->col);
+            raylib_nuklear_use_texture(state, texture.id);
+            DrawTexturePro(texture, source, dest, origin, 0, tint);
+        } break;
+
+        case NK_COMMAND_CUSTOM: {
+            const struct nk_command_custom *custom = (const struct nk_command_custom *)cmd;
+            custom->callback(NULL, (short)(custom->x * scale), (short)(custom->y * scale), (unsigned short)(custom->w * scale), (unsigned short)(custom->h * scale), custom->callback_data);
+            raylib_nuklear_use_texture(state, 0);
+            // The callback may have changed the shader.
+            if (state->sdfShader != NULL) {
+                BeginShaderMode(*state->sdfShader);
+            }
+        } break;
+
+        default: {
+            TraceLog(LOG_WARNING, "NUKLEAR: Missing implementation %i", cmd->type);
+        } break;
+    }
+}
+
+/**
+ * Hash the commands of the given window, for the window cache.
+ *
+ * @return False when the window cannot be cached, as it has an open popup or a custom command.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_hash_window(const struct nk_context * ctx, const struct nk_window* win, float scale, unsigned long long* hash)
+{
+    // Popup commands are interleaved into the parent window's command buffer.
+    if (win->popup.active) {
+        return false;
+    }
+
+    const nk_byte* buffer = (const nk_byte*)ctx->memory.memory.ptr;
+    nk_size offset = win->buffer.begin;
+    *hash = raylib_nuklear_hash(&scale, sizeof(scale), RAYLIB_NUKLEAR_HASH_SEED);
+    for (;;) {
+        const struct nk_command* cmd = (const struct nk_command*)(buffer + offset);
+        if (cmd->type == NK_COMMAND_CUSTOM) {
+            return false;
+        }
+
+        // The last command's next offset points to the next window, so use the end of the window's buffer instead.
+        nk_size end = (offset == win->buffer.last) ? win->buffer.end : cmd->next;
+        if (end <= offset + sizeof(struct nk_command)) {
+            return false;
+        }
+
+        // Skip the next offset, which depends on where the window is in the command memory.
+        *hash = raylib_nuklear_hash(&cmd->type, sizeof(cmd->type), *hash);
+        *hash = raylib_nuklear_hash(buffer + offset + sizeof(struct nk_command), end - offset - sizeof(struct nk_command), *hash);
+
+        if (offset == win->buffer.last) {
+            break;
+        }
+        offset = cmd->next;
+    }
+
+    return true;
+}
+
+/**
+ * Draw the given window from its cached render texture, rendering it into the cache first if its commands changed.
+ *
+ * @return False when the window cannot be cached, in which case its commands need to be drawn directly.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_draw_cached_window(struct nk_context * ctx, NuklearUserData* userData, const struct nk_window* win, NuklearDrawState* state)
+{
+    const float scale = state->scale;
+    unsigned long long hash;
+    if (!raylib_nuklear_hash_window(ctx, win, scale, &hash)) {
+        return false;
+    }
+
+    int width = (int)(win->bounds.w * scale);
+    int height = (int)(win->bounds.h * scale);
+    if (width <= 0 || height <= 0) {
+        return false;
     }
-    userFont->userdata = nk_handle_ptr(newFont);
-    userFont->height = fontSize;
-    userFont->width = nk_raylib_font_get_text_width_user_font;
 
-    // Nuklear context.
-    return InitNuklearContext(userFont);
+    // Find the window's cache entry, or add a new one.
+    NuklearWindowCache* entry = NULL;
+    for (int i = 0; i < userData->window_cache_count; i++) {
+        if (userData->window_cache[i].name == win->name) {
+            entry = &userData->window_cache[i];
+            break;
+        }
+    }
+    if (entry == NULL) {
+        if (userData->window_cache_count == userData->window_cache_capacity) {
+            int capacity = (userData->window_cache_capacity == 0) ? 8 : userData->window_cache_capacity * 2;
+            NuklearWindowCache* grown = (NuklearWindowCache*)MemRealloc(userData->window_cache, (unsigned int)((size_t)capacity * sizeof(NuklearWindowCache)));
+            if (grown == NULL) {
+                return false;
+            }
+            userData->window_cache = grown;
+            userData->window_cache_capacity = capacity;
+        }
+        entry = &userData->window_cache[userData->window_cache_count++];
+        entry->name = win->name;
+        entry->hash = 0;
+        entry->target = CLITERAL(RenderTexture2D) {0};
+    }
+    entry->frame = userData->frame;
+
+    // Resized windows need a new render texture.
+    if (entry->target.texture.width != width || entry->target.texture.height != height) {
+        if (entry->target.id != 0) {
+            UnloadRenderTexture(entry->target);
+        }
+        entry->target = LoadRenderTexture(width, height);
+        entry->hash = 0;
+        if (entry->target.id == 0) {
+            return false;
+        }
+    }
+
+    Vector2 origin = {win->bounds.x * scale, win->bounds.y * scale};
+
+    // The previous window may have left a scissor active.
+    raylib_nuklear_end_scissor(state);
+
+    if (entry->hash != hash) {
+        userData->stats.cacheMisses++;
+        Rectangle view = {origin.x, origin.y, (float)width, (float)height};
+        NuklearDrawState target = {scale, origin, view, view, false, {0, 0, 0, 0}, state->stats, state->sdfShader, state->atlas, state->shapesTexture, 0, false, state->textRuns};
+        BeginTextureMode(entry->target);
+            ClearBackground(BLANK);
+            rlPushMatrix();
+                rlTranslatef(-origin.x, -origin.y, 0.0f);
+                const nk_byte* buffer = (const nk_byte*)ctx->memory.memory.ptr;
+                nk_size offset = win->buffer.begin;
+                for (;;) {
+                    const struct nk_command* cmd = (const struct nk_command*)(buffer + offset);
+                    raylib_nuklear_draw_command(ctx, cmd, &target);
+                    if (offset == win->buffer.last) break;
+                    offset = cmd->next;
+                }
+            rlPopMatrix();
+            raylib_nuklear_end_scissor(&target);
+            raylib_nuklear_end_sdf_text(&target);
+        EndTextureMode();
+        state->stats->batchFlushes += 2;
+        entry->hash = hash;
+    }
+    else {
+        userData->stats.cacheHits++;
+    }
+
+    // Render textures are flipped vertically.
+    Rectangle source = {0.0f, 0.0f, (float)width, -(float)height};
+    Rectangle dest = {origin.x, origin.y, (float)width, (float)height};
+    raylib_nuklear_use_texture(state, entry->target.texture.id);
+    DrawTexturePro(entry->target.texture, source, dest, CLITERAL(Vector2) {0.0f, 0.0f}, 0.0f, WHITE);
+    state->stats->drawCalls++;
+
+    return true;
 }
 
 /**
- * Checks if Nuklear was loaded successfully.
+ * Unload the cached windows that weren't drawn in the current frame, as they were closed or hidden.
  *
- * @param ctx The Nuklear context.
- * @return True when the Nuklear context was loaded successfully, false otherwise.
+ * @internal
  */
-NK_API bool IsNuklearValid(struct nk_context* ctx) {
-    return ctx != NULL;
+static void
+raylib_nuklear_evict_cached_windows(NuklearUserData* userData)
+{
+    for (int i = userData->window_cache_count - 1; i >= 0; i--) {
+        if (userData->window_cache[i].frame != userData->frame) {
+            if (userData->window_cache[i].target.id != 0) {
+                UnloadRenderTexture(userData->window_cache[i].target);
+            }
+            userData->window_cache[i] = userData->window_cache[--userData->window_cache_count];
+        }
+    }
 }
 
 /**
- * Load the default Nuklear font. Requires `RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT` to be defined.
- *
- * @param size The size of the font to load (optional). Provide 0 to use RAYLIB_NUKLEAR_DEFAULT_FONTSIZE.
+ * Draw the given Nuklear context with one raylib call per Nuklear command.
  *
- * @return The loaded font, or an empty font on error.
+ * @internal
+ */
+static void
+raylib_nuklear_draw(struct nk_context * ctx)
+{
+    const struct nk_command *cmd;
+    NuklearRenderStats stats = {0};
+    const Rectangle view = raylib_nuklear_get_view();
+    NuklearDrawState state = {GetNuklearScaling(ctx), CLITERAL(Vector2) {0.0f, 0.0f}, view, view, false, {0, 0, 0, 0}, &stats, NULL, NULL, rlGetTextureIdDefault(), 0, false, NULL};
+
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+    bool windowCache = false;
+#if RAYLIB_VERSION_MAJOR >= 5
+    Texture2D shapesTexture = GetShapesTexture();
+    Rectangle shapesSource = GetShapesTextureRectangle();
+    state.shapesTexture = shapesTexture.id;
+#endif
+    if (userData != NULL) {
+        userData->frame++;
+        userData->stats = stats;
+        state.stats = &userData->stats;
+        windowCache = userData->window_cache_enabled;
+        if (userData->arena == NULL) {
+            // Contexts in fixed memory go without the glyph cache, as it allocates whenever new text shows up.
+            state.textRuns = &userData->text_runs;
+            userData->text_runs.frame = userData->frame;
+        }
+        if (userData->sdf_shader.id != 0) {
+            state.sdfShader = &userData->sdf_shader;
+            BeginShaderMode(userData->sdf_shader);
+        }
+        if (userData->atlas != NULL) {
+            state.atlas = userData->atlas;
+            raylib_nuklear_atlas_update(ctx, userData->atlas, userData->frame);
+#if RAYLIB_VERSION_MAJOR >= 5
+            // Draw shapes with the atlas's white texel, so they share a texture with the text.
+            if (userData->atlas->white.width > 0) {
+                SetShapesTexture(userData->atlas->pages[0].texture, userData->atlas->white);
+                state.shapesTexture = userData->atlas->pages[0].texture.id;
+            }
+#endif
+        }
+    }
+
+    const struct nk_window* win = ctx->begin;
+    nk_foreach(cmd, ctx) {
+        if (windowCache) {
+            // Window commands are linked in window order, so only the next visible window can begin here.
+            while (win != NULL && (win->buffer.last == win->buffer.begin || (win->flags & NK_WINDOW_HIDDEN) || win->seq != ctx->seq)) {
+                win = win->next;
+            }
+
+            nk_size offset = (nk_size)((const nk_byte*)cmd - (const nk_byte*)ctx->memory.memory.ptr);
+            if (win != NULL && offset == win->buffer.begin) {
+                const struct nk_window* current = win;
+                win = win->next;
+                if (raylib_nuklear_draw_cached_window(ctx, userData, current, &state)) {
+                    // Skip the window's commands, as it was drawn from the cache.
+                    while (cmd != NULL && offset != current->buffer.last) {
+                        cmd = nk__next(ctx, cmd);
+                        offset = (nk_size)((const nk_byte*)cmd - (const nk_byte*)ctx->memory.memory.ptr);
+                    }
+                    if (cmd == NULL) break;
+                    continue;
+                }
+            }
+        }
+
+        raylib_nuklear_draw_command(ctx, cmd, &state);
+    }
+    raylib_nuklear_end_scissor(&state);
+    raylib_nuklear_end_sdf_text(&state);
+
+    if (state.sdfShader != NULL) {
+        EndShaderMode();
+    }
+
+#if RAYLIB_VERSION_MAJOR >= 5
+    if (state.shapesTexture != shapesTexture.id) {
+        SetShapesTexture(shapesTexture, shapesSource);
+    }
+#endif
+
+    if (windowCache) {
+        raylib_nuklear_evict_cached_windows(userData);
+    }
+    if (userData != NULL) {
+        raylib_nuklear_evict_text_runs(&userData->text_runs);
+    }
+
+    raylib_nuklear_update_dynamic_fonts();
+    nk_clear(ctx);
+}
+
+/**
+ * Draw the given Nuklear context by converting it to vertex buffers with nk_convert().
  *
- * @code
- * #define RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT
- * #include "raylib-nuklear.h"
- * Font font = LoadFontFromNuklear(0);
- * @endcode
+ * @internal
  */
-NK_API Font LoadFontFromNuklear(int size) {
-#ifndef RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT
-    (void)size;
-    TraceLog(LOG_ERROR, "NUKLEAR: RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT must be defined to use LoadFontFromNuklear()");
-    return CLITERAL(Font) {0};
+static void
+raylib_nuklear_draw_batched(struct nk_context * ctx)
+{
+#ifndef RAYLIB_NUKLEAR_USE_VERTEX_BUFFER
+    TraceLog(LOG_WARNING, "NUKLEAR: RAYLIB_NUKLEAR_USE_VERTEX_BUFFER must be defined to use DrawNuklearBatched(), falling back to DrawNuklear()");
+    raylib_nuklear_draw(ctx);
 #else
-    if (size <= 0) {
-        size = RAYLIB_NUKLEAR_DEFAULT_FONTSIZE;
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+    if (userData == NULL || userData->arena != NULL) {
+        raylib_nuklear_draw(ctx);
+        return;
     }
 
-    #ifndef RAYLIB_NUKLEAR_DEFAULT_FONT_GLYPHS
-    /**
-     * The amount of glyphs to load for the default font.
-     */
-    #define RAYLIB_NUKLEAR_DEFAULT_FONT_GLYPHS 95
-    #endif
+    static const struct nk_draw_vertex_layout_element vertexLayout[] = {
+        {NK_VERTEX_POSITION, NK_FORMAT_FLOAT, NK_OFFSETOF(NuklearVertex, position)},
+        {NK_VERTEX_TEXCOORD, NK_FORMAT_FLOAT, NK_OFFSETOF(NuklearVertex, uv)},
+        {NK_VERTEX_COLOR, NK_FORMAT_R8G8B8A8, NK_OFFSETOF(NuklearVertex, col)},
+        {NK_VERTEX_LAYOUT_END}
+    };
+
+    struct nk_convert_config config;
+    nk_memset(&config, 0, sizeof(config));
+    config.vertex_layout = vertexLayout;
+    config.vertex_size = sizeof(NuklearVertex);
+    config.vertex_alignment = NK_ALIGNOF(NuklearVertex);
+    config.tex_null.texture = nk_handle_id((int)rlGetTextureIdDefault());
+    config.tex_null.uv = nk_vec2(0.5f, 0.5f);
+    config.circle_segment_count = RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS;
+    config.arc_segment_count = RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS;
+    config.curve_segment_count = RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS;
+    config.global_alpha = 1.0f;
+    config.shape_AA = NK_ANTI_ALIASING_ON;
+    config.line_AA = NK_ANTI_ALIASING_ON;
+
+    // Reuse the buffers from the previous frame, which keeps their capacity.
+    nk_buffer_clear(&userData->commands);
+    nk_buffer_clear(&userData->vertices);
+    nk_buffer_clear(&userData->elements);
+    nk_flags result = nk_convert(ctx, &userData->commands, &userData->vertices, &userData->elements, &config);
+    if (result != NK_CONVERT_SUCCESS) {
+        TraceLog(LOG_WARNING, "NUKLEAR: nk_convert() failed with %i", (int)result);
+        nk_clear(ctx);
+        return;
+    }
 
-    // Decode base85 -> compressed binary -> raw TTF
-    int compressed_size = (((int)nk_strlen(nk_proggy_clean_ttf_compressed_data_base85) + 4) / 5) * 4;
-    unsigned char *compressed_data = (unsigned char*)MemAlloc((unsigned int)compressed_size);
-    if (compressed_data == NULL) {
-        TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate the default font data");
-        return CLITERAL(Font) {0};
+    const float scale = GetNuklearScaling(ctx);
+    const NuklearVertex* vertices = (const NuklearVertex*)nk_buffer_memory_const(&userData->vertices);
+    // nk_convert() queried the glyphs, so the dynamic fonts have what they need.
+    raylib_nuklear_update_dynamic_fonts();
+
+    const nk_draw_index* offset = (const nk_draw_index*)nk_buffer_memory_const(&userData->elements);
+    const struct nk_draw_command* cmd;
+    struct nk_rect clip = nk_rect(0, 0, -1, -1);
+
+    nk_draw_foreach(cmd, ctx, &userData->commands) {
+        if (cmd->elem_count == 0) {
+            continue;
+        }
+
+        // Only change the scissor when the clip rectangle changes, as each change flushes the batch.
+        if (cmd->clip_rect.x != clip.x || cmd->clip_rect.y != clip.y || cmd->clip_rect.w != clip.w || cmd->clip_rect.h != clip.h) {
+            clip = cmd->clip_rect;
+            if (clip.x <= -8000) {
+                EndScissorMode();
+            } else {
+                BeginScissorMode((int)(clip.x * scale), (int)(clip.y * scale), (int)(clip.w * scale), (int)(clip.h * scale));
+            }
+        }
+
+        // Text of signed distance field fonts needs their shader.
+        const Shader* textShader = raylib_nuklear_sdf_text_shader_for((unsigned int)cmd->texture.id);
+        if (textShader != NULL) {
+            BeginShaderMode(*textShader);
+        }
+        rlSetTexture((unsigned int)cmd->texture.id);
+        rlBegin(RL_TRIANGLES);
+        for (unsigned int i = 0; i < cmd->elem_count; i++) {
+            const NuklearVertex* vertex = &vertices[offset[i]];
+            rlColor4ub(vertex->col[0], vertex->col[1], vertex->col[2], vertex->col[3]);
+            rlTexCoord2f(vertex->uv[0], vertex->uv[1]);
+            rlVertex2f(vertex->position[0] * scale, vertex->position[1] * scale);
+        }
+        rlEnd();
+        rlSetTexture(0);
+        if (textShader != NULL) {
+            EndShaderMode();
+        }
+
+        offset += cmd->elem_count;
     }
-    nk_decode_85(compressed_data, (const unsigned char*)nk_proggy_clean_ttf_compressed_data_base85);
 
-    unsigned int ttf_size = nk_decompress_length(compressed_data);
-    unsigned char *ttf_data = (unsigned char*)MemAlloc(ttf_size);
-    if (ttf_data == NULL) {
-        TraceLog(LOG_ERROR, "NUKLEAR: Failed to allocate the default font data");
-        MemFree(compressed_data);
-        return CLITERAL(Font) {0};
+    if (clip.w >= 0 && clip.x > -8000) {
+        EndScissorMode();
     }
-    nk_decompress(ttf_data, compressed_data, (unsigned int)compressed_size);
-    MemFree(compressed_data);
 
-    Font font = LoadFontFromMemory(".ttf", ttf_data, (int)ttf_size, size, NULL, RAYLIB_NUKLEAR_DEFAULT_FONT_GLYPHS);
-    MemFree(ttf_data);
-    return font;
-#endif
+    nk_clear(ctx);
+#endif  // RAYLIB_NUKLEAR_USE_VERTEX_BUFFER
 }
 
 /**
- * Convert the given Nuklear color to a raylib color.
+ * Hash everything that affects how the current frame is drawn: the command memory, the scaling and the render size.
+ *
+ * @return False when the frame has custom commands, which can draw anything.
+ *
+ * @internal
  */
-NK_API Color
-NuklearColorToColor(struct nk_color color)
+static bool
+raylib_nuklear_hash_frame(struct nk_context * ctx, unsigned long long* hash)
 {
-    Color rc;
-    rc.a = color.a;
-    rc.r = color.r;
-    rc.g = color.g;
-    rc.b = color.b;
-    return rc;
+    // Iterating the commands builds the command list, which links the window buffers in the command memory.
+    const struct nk_command *cmd;
+    nk_foreach(cmd, ctx) {
+        if (cmd->type == NK_COMMAND_CUSTOM) {
+            return false;
+        }
+    }
+
+    float scale = GetNuklearScaling(ctx);
+    int size[2] = {GetRenderWidth(), GetRenderHeight()};
+    *hash = raylib_nuklear_hash(&scale, sizeof(scale), RAYLIB_NUKLEAR_HASH_SEED);
+    *hash = raylib_nuklear_hash(size, sizeof(size), *hash);
+    *hash = raylib_nuklear_hash(ctx->memory.memory.ptr, ctx->memory.allocated, *hash);
+    return true;
 }
 
 /**
- * Convert the given raylib color to a Nuklear color.
+ * Check whether the current frame differs from the last drawn frame, hashing it once until nk_clear() moves on to the
+ * next frame, as IsNuklearFrameChanged() and DrawNuklear() both check it.
+ *
+ * @internal
  */
-NK_API struct nk_color
-ColorToNuklearColor(Color color)
+static bool
+raylib_nuklear_frame_changed(struct nk_context * ctx, NuklearUserData* userData)
 {
-    struct nk_color rc;
-    rc.a = color.a;
-    rc.r = color.r;
-    rc.g = color.g;
-    rc.b = color.b;
-    return rc;
+    if (!userData->frame_hashed || userData->frame_seq != ctx->seq) {
+        userData->frame_hashed = true;
+        userData->frame_seq = ctx->seq;
+        userData->frame_hashable = raylib_nuklear_hash_frame(ctx, &userData->frame_seq_hash);
+    }
+    return !userData->frame_tracking || !userData->frame_hashable || userData->frame_seq_hash != userData->frame_hash;
 }
 
 /**
- * Convert the given Nuklear float color to a raylib color.
+ * Check whether the Nuklear GUI that was built this frame differs from the last frame that was drawn.
+ *
+ * The first call enables tracking the drawn frames, so that the following DrawNuklear() calls remember
+ * what they drew. This allows skipping BeginDrawing() and EndDrawing() entirely on idle frames. Call it after the
+ * frame is built, and clear unchanged frames with nk_clear() rather than drawing them.
+ *
+ * @param ctx The nuklear context.
+ *
+ * @return True when the frame changed, or when it cannot be known.
+ *
+ * @code
+ * if (IsNuklearFrameChanged(ctx)) {
+ *     BeginDrawing();
+ *         ClearBackground(RAYWHITE);
+ *         DrawNuklear(ctx);
+ *     EndDrawing();
+ * } else {
+ *     nk_clear(ctx);
+ *     PollInputEvents(); // EndDrawing() would have polled input events
+ * }
+ * @endcode
+ *
+ * @see DrawNuklearEx()
  */
-NK_API Color
-NuklearColorFToColor(struct nk_colorf color)
+NK_API bool
+IsNuklearFrameChanged(struct nk_context * ctx)
 {
-    return NuklearColorToColor(nk_rgba_cf(color));
+    if (ctx == NULL) {
+        return false;
+    }
+
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+    if (userData == NULL) {
+        return true;
+    }
+
+    bool changed = raylib_nuklear_frame_changed(ctx, userData);
+    userData->frame_tracking = true;
+    return changed;
 }
 
 /**
- * Convert the given raylib color to a raylib float color.
+ * Note how much of the fixed memory of a context is in use, before nk_clear() releases the frame's commands.
+ *
+ * @internal
  */
-NK_API struct nk_colorf
-ColorToNuklearColorF(Color color)
+static void
+raylib_nuklear_track_arena(struct nk_context* ctx, NuklearUserData* userData)
 {
-    return nk_color_cf(ColorToNuklearColor(color));
+    if (userData->arena == NULL) {
+        return;
+    }
+
+    // Commands are allocated from the front of Nuklear's memory, and windows from the back.
+    const struct nk_buffer* memory = &ctx->memory;
+    nk_size allocated = memory->allocated + (memory->memory.size - memory->size);
+    userData->arena_peak = NK_MAX(userData->arena_peak, userData->arena_header + allocated);
+
+    // Allocations that failed are counted as needed without being allocated.
+    if (memory->needed > allocated) {
+        userData->arena_overflow = true;
+    }
 }
 
 /**
- * Convert the given Nuklear image to a raylib Texture
+ * Resize Nuklear's command buffer while it's empty, so that its commands don't need copying.
+ *
+ * @return True when the command buffer has the given size.
  *
  * @internal
  */
-static struct Texture
-NuklearImageToTexture(struct nk_image img)
+static bool
+raylib_nuklear_resize_commands(struct nk_context* ctx, nk_size size)
 {
-	Texture texture = {0};
-	texture.id = (unsigned int)img.handle.id;
-	texture.width = (int)img.w;
-	texture.height = (int)img.h;
-	texture.mipmaps = 1;
-	return texture;
+    struct nk_buffer* memory = &ctx->memory;
+    if (memory->memory.size == size) {
+        return true;
+    }
+
+    // Only dynamic buffers that hold nothing, front or back, can be resized.
+    if (memory->type != NK_BUFFER_DYNAMIC || memory->allocated != 0 || memory->size != memory->memory.size ||
+        memory->pool.alloc == NULL || memory->pool.free == NULL) {
+        return false;
+    }
+
+    void* block = memory->pool.alloc(memory->pool.userdata, memory->memory.ptr, size);
+    if (block == NULL) {
+        return false;
+    }
+    if (block != memory->memory.ptr) {
+        memory->pool.free(memory->pool.userdata, memory->memory.ptr);
+    }
+    memory->memory.ptr = block;
+    memory->memory.size = size;
+    memory->size = size;
+    return true;
+}
+
+/**
+ * Note how much of the command buffer the frame that's being drawn needed, before nk_clear() resets it.
+ *
+ * @internal
+ */
+static void
+raylib_nuklear_track_commands(struct nk_context* ctx, NuklearCommandPlanner* plan)
+{
+    if (ctx->memory.type != NK_BUFFER_DYNAMIC) {
+        return;
+    }
+
+    plan->demand[plan->demandIndex] = ctx->memory.needed;
+    plan->demandIndex = (plan->demandIndex + 1) % RAYLIB_NUKLEAR_COMMAND_HISTORY;
+    if (plan->demandCount < RAYLIB_NUKLEAR_COMMAND_HISTORY) {
+        plan->demandCount++;
+    }
 }
 
 /**
- * Draw a filled polygon using Nuklear values.
+ * Resize the command buffer for the recent frames' demand, once nk_clear() emptied it.
  *
- * @see nk_rawfb_fill_polygon()
- * @see https://github.com/Immediate-Mode-UI/Nuklear/blob/master/demo/rawfb/nuklear_rawfb.h
+ * The buffer grows to the planned capacity right away, so that the next frames don't grow it while they're built.
+ * It only shrinks once it's been more than twice as large as planned for the plan's shrinkFrames.
  *
  * @internal
- * @todo Replace this software rendering with a GPU renderer
  */
-static void raylib_nuklear_draw_polygon_fill(float scale, const struct nk_vec2i *pnts, int count, Color col) {
-    int i = 0;
-    int left = 10000, top = 10000, bottom = 0, right = 0;
-    int nodes, nodeX[RAYLIB_NUKLEAR_POLYGON_FILL_MAX_POINTS], pixelX, pixelY, j, swap ;
-
-    if (count == 0) return;
-    if (count > RAYLIB_NUKLEAR_POLYGON_FILL_MAX_POINTS) {
-        TraceLog(LOG_WARNING, "NUKLEAR: NK_COMMAND_POLYGON_FILLED point count %d exceeds max %d, truncating. Define RAYLIB_NUKLEAR_POLYGON_FILL_MAX_POINTS to increase.", count, RAYLIB_NUKLEAR_POLYGON_FILL_MAX_POINTS);
-        count = RAYLIB_NUKLEAR_POLYGON_FILL_MAX_POINTS;
-    }
-
-    /* Build scaled copy of points */
-    int scaled_x[RAYLIB_NUKLEAR_POLYGON_FILL_MAX_POINTS];
-    int scaled_y[RAYLIB_NUKLEAR_POLYGON_FILL_MAX_POINTS];
-    for (i = 0; i < count; i++) {
-        scaled_x[i] = (int)(pnts[i].x * scale);
-        scaled_y[i] = (int)(pnts[i].y * scale);
-    }
-
-    /* Get polygon dimensions */
-    for (i = 0; i < count; i++) {
-        if (left > scaled_x[i])
-            left = scaled_x[i];
-        if (right < scaled_x[i])
-            right = scaled_x[i];
-        if (top > scaled_y[i])
-            top = scaled_y[i];
-        if (bottom < scaled_y[i])
-            bottom = scaled_y[i];
-    } bottom++; right++;
-
-    /* Polygon scanline algorithm released under public-domain by Darel Rex Finley, 2007 */
-    /*  Loop through the rows of the image. */
-    for (pixelY = top; pixelY < bottom; pixelY ++) {
-        nodes = 0; /*  Build a list of nodes. */
-        j = count - 1;
-        for (i = 0; i < count; i++) {
-            if (((scaled_y[i] < pixelY) && (scaled_y[j] >= pixelY)) ||
-                ((scaled_y[j] < pixelY) && (scaled_y[i] >= pixelY))) {
-                nodeX[nodes++]= (int)((float)scaled_x[i]
-                     + ((float)pixelY - (float)scaled_y[i]) / ((float)scaled_y[j] - (float)scaled_y[i])
-                     * ((float)scaled_x[j] - (float)scaled_x[i]));
-            } j = i;
-        }
-
-        /*  Sort the nodes, via a simple “Bubble” sort. */
-        i = 0;
-        while (i < nodes - 1) {
-            if (nodeX[i] > nodeX[i+1]) {
-                swap = nodeX[i];
-                nodeX[i] = nodeX[i+1];
-                nodeX[i+1] = swap;
-                if (i) i--;
-            } else i++;
-        }
-        /*  Fill the pixels between node pairs. */
-        for (i = 0; i + 1 < nodes; i += 2) {
-            if (nodeX[i+0] >= right) break;
-            if (nodeX[i+1] > left) {
-                if (nodeX[i+0] < left) nodeX[i+0] = left ;
-                if (nodeX[i+1] > right) nodeX[i+1] = right;
-                for (pixelX = nodeX[i]; pixelX < nodeX[i + 1]; pixelX++) {
-                    DrawPixel(pixelX, pixelY, col);
-                }
+static void
+raylib_nuklear_plan_commands(struct nk_context* ctx, NuklearCommandPlanner* plan)
+{
+    if (ctx->memory.type != NK_BUFFER_DYNAMIC || plan->demandCount == 0) {
+        return;
+    }
 
-            }
+    // Find the percentile of the demand, with an insertion sort of the few frames that are kept.
+    size_t sorted[RAYLIB_NUKLEAR_COMMAND_HISTORY];
+    for (int i = 0; i < plan->demandCount; i++) {
+        size_t demand = plan->demand[i];
+        int j = i;
+        while (j > 0 && sorted[j - 1] > demand) {
+            sorted[j] = sorted[j - 1];
+            j--;
         }
+        sorted[j] = demand;
+    }
+    int index = (plan->demandCount * RAYLIB_NUKLEAR_COMMAND_PERCENTILE + 99) / 100 - 1;
+    size_t demand = sorted[NK_CLAMP(0, index, plan->demandCount - 1)];
+
+    // Plan for the percentile rounded up to a power of two, like Nuklear grows the buffer.
+    size_t target = NK_DEFAULT_COMMAND_BUFFER_SIZE;
+    while (target < demand) {
+        target *= 2;
+    }
+    plan->target = NK_MAX(target, plan->reserved);
+
+    nk_size capacity = ctx->memory.memory.size;
+    if (capacity < plan->target) {
+        plan->quietFrames = 0;
+        raylib_nuklear_resize_commands(ctx, plan->target);
+    }
+    else if (plan->shrinkFrames > 0 && capacity > plan->target * 2) {
+        if (++plan->quietFrames >= plan->shrinkFrames && raylib_nuklear_resize_commands(ctx, plan->target)) {
+            plan->quietFrames = 0;
+        }
+    }
+    else {
+        plan->quietFrames = 0;
     }
 }
 
 /**
- * Draw the given Nuklear context in raylib.
+ * Draw the given Nuklear context in raylib, with the given NuklearDrawFlags.
  *
  * @param ctx The nuklear context.
+ * @param flags A combination of NuklearDrawFlags.
+ *
+ * @return True when the frame differs from the previously drawn frame, false when it's identical. Frames are only
+ *         compared once IsNuklearFrameChanged() enabled tracking them, before which this is always true.
+ *
+ * @see IsNuklearFrameChanged()
  */
-NK_API void
-DrawNuklear(struct nk_context * ctx)
+NK_API bool
+DrawNuklearEx(struct nk_context * ctx, unsigned int flags)
 {
     // Protect against drawing when there's nothing to draw.
     if (ctx == NULL) {
-        return;
+        return false;
     }
 
-    const struct nk_command *cmd;
-    const float scale = GetNuklearScaling(ctx);
-
-    nk_foreach(cmd, ctx) {
-        switch (cmd->type) {
-            case NK_COMMAND_NOP: {
-                break;
-            }
-
-            case NK_COMMAND_SCISSOR: {
-                const struct nk_command_scissor *s = (const struct nk_command_scissor*)cmd;
-                if (s->x <= -8000) {
-                    EndScissorMode();
-                } else {
-                    BeginScissorMode((int)(s->x * scale), (int)(s->y * scale), (int)(s->w * scale), (int)(s->h * scale));
-                }
-            } break;
-
-            case NK_COMMAND_LINE: {
-                const struct nk_command_line *l = (const struct nk_command_line *)cmd;
-                Color color = NuklearColorToColor(l->color);
-                Vector2 startPos = CLITERAL(Vector2) {(float)l->begin.x * scale, (float)l->begin.y * scale};
-                Vector2 endPos = CLITERAL(Vector2) {(float)l->end.x * scale, (float)l->end.y * scale};
-                DrawLineEx(startPos, endPos, l->line_thickness * scale, color);
-            } break;
-
-            case NK_COMMAND_CURVE: {
-                const struct nk_command_curve *q = (const struct nk_command_curve *)cmd;
-                Color color = NuklearColorToColor(q->color);
-                Vector2 begin = CLITERAL(Vector2) {(float)q->begin.x * scale, (float)q->begin.y * scale};
-                Vector2 controlPoint1 = CLITERAL(Vector2) {(float)q->ctrl[0].x * scale, (float)q->ctrl[0].y * scale};
-                Vector2 controlPoint2 = CLITERAL(Vector2) {(float)q->ctrl[1].x * scale, (float)q->ctrl[1].y * scale};
-                Vector2 end = CLITERAL(Vector2) {(float)q->end.x * scale, (float)q->end.y * scale};
-#if defined(RAYLIB_VERSION_MAJOR) && RAYLIB_VERSION_MAJOR >= 5
-                DrawSplineSegmentBezierCubic(begin, controlPoint1, controlPoint2, end, (float)q->line_thickness * scale, color);
-#else
-                // raylib < 5.0 named this DrawLineBezierCubic
-                DrawLineBezierCubic(begin, controlPoint1, controlPoint2, end, (float)q->line_thickness * scale, color);
-#endif
-            } break;
-
-            case NK_COMMAND_RECT: {
-                const struct nk_command_rect *r = (const struct nk_command_rect *)cmd;
-                Color color = NuklearColorToColor(r->color);
-                Rectangle rect = CLITERAL(Rectangle) {(float)r->x * scale, (float)r->y * scale, (float)r->w * scale, (float)r->h * scale};
-                // We manually draw the rectangle with rounding instead of using DrawRectangleEx(), as we have more control over the corners.
-                if (r->rounding > 0) {
-                    float rad = NK_MIN((float)r->rounding * scale, NK_MIN(rect.width, rect.height) * 0.5f);
-                    float thick = (float)r->line_thickness * scale;
-                    // Straight edges
-                    DrawRectangleRec((Rectangle){rect.x + rad, rect.y, rect.width - 2.0f * rad, thick}, color);
-                    DrawRectangleRec((Rectangle){rect.x + rad, rect.y + rect.height - thick, rect.width - 2.0f * rad, thick}, color);
-                    DrawRectangleRec((Rectangle){rect.x, rect.y + rad, thick, rect.height - 2.0f * rad}, color);
-                    DrawRectangleRec((Rectangle){rect.x + rect.width - thick, rect.y + rad, thick, rect.height - 2.0f * rad}, color);
-                    // Corner quarter-arc rings
-                    DrawRing((Vector2){rect.x + rad, rect.y + rad}, NK_MAX(rad - thick, 0.0f), rad, 180.0f, 270.0f, RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS, color);
-                    DrawRing((Vector2){rect.x + rect.width - rad,  rect.y + rad}, NK_MAX(rad - thick, 0.0f), rad, 270.0f, 360.0f, RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS, color);
-                    DrawRing((Vector2){rect.x + rect.width - rad, rect.y + rect.height - rad}, NK_MAX(rad - thick, 0.0f), rad,   0.0f,  90.0f, RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS, color);
-                    DrawRing((Vector2){rect.x + rad, rect.y + rect.height - rad}, NK_MAX(rad - thick, 0.0f), rad,  90.0f, 180.0f, RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS, color);
-                }
-                else {
-                    DrawRectangleLinesEx(rect, r->line_thickness * scale, color);
-                }
-            } break;
-
-            case NK_COMMAND_RECT_FILLED: {
-                const struct nk_command_rect_filled *r = (const struct nk_command_rect_filled *)cmd;
-                Color color = NuklearColorToColor(r->color);
-                Rectangle rect = CLITERAL(Rectangle) {(float)r->x * scale, (float)r->y * scale, (float)r->w * scale, (float)r->h * scale};
-                // We manually draw the rectangle with rounding instead of using DrawRectangleEx(), as we have more control over the corners.
-                if (r->rounding > 0) {
-                    float rad = NK_MIN((float)r->rounding * scale, NK_MIN(rect.width, rect.height) * 0.5f);
-                    // Center vertical strip + top/bottom horizontal strips
-                    DrawRectangleRec((Rectangle){rect.x, rect.y + rad, rect.width, rect.height - 2.0f * rad}, color);
-                    DrawRectangleRec((Rectangle){rect.x + rad, rect.y, rect.width - 2.0f * rad, rad}, color);
-                    DrawRectangleRec((Rectangle){rect.x + rad, rect.y + rect.height - rad, rect.width - 2.0f * rad, rad}, color);
-                    // Corner quarter-circle arcs
-                    DrawCircleSector((Vector2){rect.x + rad, rect.y + rad}, rad, 180.0f, 270.0f, RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS, color);
-                    DrawCircleSector((Vector2){rect.x + rect.width - rad, rect.y + rad}, rad, 270.0f, 360.0f, RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS, color);
-                    DrawCircleSector((Vector2){rect.x + rect.width - rad, rect.y + rect.height - rad}, rad, 0.0f, 90.0f, RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS, color);
-                    DrawCircleSector((Vector2){rect.x + rad, rect.y + rect.height - rad}, rad, 90.0f, 180.0f, RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS, color);
-                }
-                else {
-                    DrawRectangleRec(rect, color);
-                }
-            } break;
-
-            case NK_COMMAND_RECT_MULTI_COLOR: {
-                const struct nk_command_rect_multi_color* rectangle = (const struct nk_command_rect_multi_color *)cmd;
-                Rectangle position = {(float)rectangle->x * scale, (float)rectangle->y * scale, (float)rectangle->w * scale, (float)rectangle->h * scale};
-                // raylib's DrawRectangleGradientEx() takes corners in the order
-                // (topLeft, bottomLeft, bottomRight, topRight). Nuklear maps its
-                // rect_multi_color fields to corners as left=topLeft, top=topRight,
-                // right=bottomRight, bottom=bottomLeft (see nk_draw_list_fill_rect_multi_color).
-                DrawRectangleGradientEx(position,
-                    NuklearColorToColor(rectangle->left),   // Top Left
-                    NuklearColorToColor(rectangle->bottom), // Bottom Left
-                    NuklearColorToColor(rectangle->right),  // Bottom Right
-                    NuklearColorToColor(rectangle->top)     // Top Right
-                );
-            } break;
-
-            case NK_COMMAND_CIRCLE: {
-                const struct nk_command_circle *c = (const struct nk_command_circle *)cmd;
-                Color color = NuklearColorToColor(c->color);
-                float cx = (c->x + c->w / 2.0f) * scale;
-                float cy = (c->y + c->h / 2.0f) * scale;
-                float thick = (float)c->line_thickness * scale;
-                if (c->w == c->h) {
-                    float outerR = c->w * scale / 2.0f;
-                    float innerR = NK_MAX(outerR - thick, 0.0f);
-                    DrawRing((Vector2){cx, cy}, innerR, outerR, 0.0f, 360.0f, RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS, color);
-                }
-                else {
-                    unsigned short size = (unsigned short)(thick * 2.0f);
-                    for (unsigned short i = 0; i < size; i++) {
-                        DrawEllipseLines((int)cx, (int)cy, c->w * scale / 2.0f - (float)i / 2.0f, c->h * scale / 2.0f - (float)i / 2.0f, color);
-                    }
-                }
-            } break;
-
-            case NK_COMMAND_CIRCLE_FILLED: {
-                const struct nk_command_circle_filled *c = (const struct nk_command_circle_filled *)cmd;
-                Color color = NuklearColorToColor(c->color);
-                DrawEllipse((int)(c->x * scale + c->w * scale / 2.0f), (int)(c->y * scale + c->h * scale / 2.0f), (int)(c->w * scale / 2), (int)(c->h * scale / 2), color);
-            } break;
-
-            case NK_COMMAND_ARC: {
-                const struct nk_command_arc *a = (const struct nk_command_arc*)cmd;
-                Color color = NuklearColorToColor(a->color);
-                Vector2 center = CLITERAL(Vector2) {(float)a->cx * scale, (float)a->cy * scale};
-                float outerRadius = a->r * scale;
-                float thick = a->line_thickness * scale;
-                float innerRadius = outerRadius - thick;
-                if (innerRadius < 0.0f) innerRadius = 0.0f;
-                DrawRing(center, innerRadius, outerRadius, a->a[0] * RAD2DEG, a->a[1] * RAD2DEG, RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS, color);
-                Vector2 p0 = {center.x + outerRadius * cosf(a->a[0]), center.y + outerRadius * sinf(a->a[0])};
-                Vector2 p1 = {center.x + outerRadius * cosf(a->a[1]), center.y + outerRadius * sinf(a->a[1])};
-                DrawLineEx(center, p0, thick, color);
-                DrawLineEx(center, p1, thick, color);
-            } break;
-
-            case NK_COMMAND_ARC_FILLED: {
-                const struct nk_command_arc_filled *a = (const struct nk_command_arc_filled*)cmd;
-                Color color = NuklearColorToColor(a->color);
-                Vector2 center = CLITERAL(Vector2) {(float)a->cx * scale, (float)a->cy * scale};
-                DrawRing(center, 0, a->r * scale, a->a[0] * RAD2DEG, a->a[1] * RAD2DEG, RAYLIB_NUKLEAR_DEFAULT_ARC_SEGMENTS, color);
-            } break;
-
-            case NK_COMMAND_TRIANGLE: {
-                const struct nk_command_triangle *t = (const struct nk_command_triangle*)cmd;
-                Color color = NuklearColorToColor(t->color);
-                Vector2 point1 = CLITERAL(Vector2) {(float)t->b.x * scale, (float)t->b.y * scale};
-                Vector2 point2 = CLITERAL(Vector2) {(float)t->a.x * scale, (float)t->a.y * scale};
-                Vector2 point3 = CLITERAL(Vector2) {(float)t->c.x * scale, (float)t->c.y * scale};
-
-                DrawLineEx(point1, point2, t->line_thickness * scale, color);
-                DrawLineEx(point2, point3, t->line_thickness * scale, color);
-                DrawLineEx(point3, point1, t->line_thickness * scale, color);
-                // TODO: Add line thickness to DrawTriangleLines(), maybe via a DrawTriangleLinesEx()?
-                // DrawTriangleLines(point1, point2, point3, color);
-            } break;
-
-            case NK_COMMAND_TRIANGLE_FILLED: {
-                const struct nk_command_triangle_filled *t = (const struct nk_command_triangle_filled*)cmd;
-                Color color = NuklearColorToColor(t->color);
-                Vector2 point1 = CLITERAL(Vector2) {(float)t->b.x * scale, (float)t->b.y * scale};
-                Vector2 point2 = CLITERAL(Vector2) {(float)t->a.x * scale, (float)t->a.y * scale};
-                Vector2 point3 = CLITERAL(Vector2) {(float)t->c.x * scale, (float)t->c.y * scale};
-                DrawTriangle(point1, point2, point3, color);
-            } break;
-
-            case NK_COMMAND_POLYGON: {
-                const struct nk_command_polygon *p = (const struct nk_command_polygon*)cmd;
-                Color color = NuklearColorToColor(p->color);
-                float thickness = (float)p->line_thickness * scale;
-                for (unsigned short i = 0; i < p->point_count - 1; i++) {
-                    Vector2 start = {(float)p->points[i].x * scale, (float)p->points[i].y * scale};
-                    Vector2 end = {(float)p->points[i + 1].x * scale, (float)p->points[i + 1].y * scale};
-                    DrawLineEx(start, end, thickness, color);
-                }
-                if (p->point_count >= 2) {
-                    Vector2 last = {(float)p->points[p->point_count - 1].x * scale, (float)p->points[p->point_count - 1].y * scale};
-                    Vector2 first = {(float)p->points[0].x * scale, (float)p->points[0].y * scale};
-                    DrawLineEx(last, first, thickness, color);
-                }
-            } break;
-
-            case NK_COMMAND_POLYGON_FILLED: {
-                const struct nk_command_polygon_filled *p = (const struct nk_command_polygon_filled*)cmd;
-                raylib_nuklear_draw_polygon_fill(scale, p->points, p->point_count, NuklearColorToColor(p->color));
-            } break;
-
-            case NK_COMMAND_POLYLINE: {
-                const struct nk_command_polyline *p = (const struct nk_command_polyline *)cmd;
-                Color color = NuklearColorToColor(p->color);
-                for (unsigned short i = 0; i < p->point_count - 1; i++) {
-                    Vector2 start = {(float)p->points[i].x * scale, (float)p->points[i].y * scale};
-                    Vector2 end = {(float)p->points[i + 1].x * scale, (float)p->points[i + 1].y * scale};
-                    DrawLineEx(start, end, p->line_thickness * scale, color);
-                }
-            } break;
-
-            case NK_COMMAND_TEXT: {
-                const struct nk_command_text *text = (const struct nk_command_text*)cmd;
-                Color color = NuklearColorToColor(text->foreground);
-                float fontSize = text->font->height * scale;
-                Font* font = (Font*)text->font->userdata.ptr;
-                if (font != NULL) {
-                    Vector2 position = {(float)text->x * scale, (float)text->y * scale};
-                    DrawTextEx(*font, (const char*)text->string, position, fontSize, fontSize * RAYLIB_NUKLEAR_FONT_SPACING_RATIO, color);
-                }
-                else {
-                    DrawText((const char*)text->string, (int)(text->x * scale), (int)(text->y * scale), (int)fontSize, color);
-                }
-            } break;
-
-            case NK_COMMAND_IMAGE: {
-                const struct nk_command_image *i = (const struct nk_command_image *)cmd;
-                Texture texture = NuklearImageToTexture(i->img);
-                Rectangle source = CLITERAL(Rectangle) {(float)i->img.region[0], (float)i->img.region[1], (float)i->img.region[2], (float)i->img.region[3]};
-                if (source.width <= 0 || source.height <= 0) {
-                    // Images from nk_image_id(), nk_image_ptr() or nk_image_handle() have an empty region; use the full texture instead.
-                    source.width = (i->img.w > 0) ? (float)i->img.w : (float)texture.width;
-                    source.height = (i->img.h > 0) ? (float)i->img.h : (float)texture.height;
-                    if (source.width <= 0 || source.height <= 0) {
-                        // The texture size is unknown (nk_image_id() only carries the id), so map the whole texture onto the destination.
-                        texture.width = 1;
-                        texture.height = 1;
-                        source.width = 1;
-                        source.height = 1;
-                    }
-                }
-                Rectangle dest = CLITERAL(Rectangle) {(float)i->x * scale, (float)i->y * scale, (float)i->w * scale, (float)i->h * scale};
-                Vector2 origin = CLITERAL(Vector2) {0, 0};
-                Color tint = NuklearColorToColor(i->col);
-                DrawTexturePro(texture, source, dest, origin, 0, tint);
-            } break;
+    bool changed = true;
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+    if (userData != NULL) {
+        raylib_nuklear_track_arena(ctx, userData);
+        raylib_nuklear_track_commands(ctx, &userData->commands_plan);
+        userData->memory.frameAllocations = userData->memory.allocations - userData->memory.frameStart;
+        userData->memory.frameStart = userData->memory.allocations;
+    }
+    if (userData != NULL && userData->frame_tracking) {
+        changed = raylib_nuklear_frame_changed(ctx, userData);
+        userData->frame_hash = userData->frame_hashable ? userData->frame_seq_hash : 0;
+    }
 
-            case NK_COMMAND_CUSTOM: {
-                const struct nk_command_custom *custom = (const struct nk_command_custom *)cmd;
-                custom->callback(NULL, (short)(custom->x * scale), (short)(custom->y * scale), (unsigned short)(custom->w * scale), (unsigned short)(custom->h * scale), custom->callback_data);
-            } break;
+    if (flags & NUKLEAR_DRAW_BATCHED) {
+        raylib_nuklear_draw_batched(ctx);
+    }
+    else {
+        raylib_nuklear_draw(ctx);
+    }
 
-            default: {
-                TraceLog(LOG_WARNING, "NUKLEAR: Missing implementation %i", cmd->type);
-            } break;
-        }
+    // The command buffer is empty after nk_clear(), so it can be resized without copying its commands.
+    if (userData != NULL) {
+        raylib_nuklear_plan_commands(ctx, &userData->commands_plan);
+        raylib_nuklear_collect_states(ctx, &userData->states);
+        userData->hash_memo.frame++;
+        userData->hash_memo.copySize = 0;
     }
 
-    nk_clear(ctx);
+    return changed;
+}
+
+/**
+ * Draw the given Nuklear context in raylib.
+ *
+ * @param ctx The nuklear context.
+ */
+NK_API void
+DrawNuklear(struct nk_context * ctx)
+{
+    DrawNuklearEx(ctx, NUKLEAR_DRAW_DEFAULT);
+}
+
+/**
+ * Draw the given Nuklear context in raylib, by converting it to vertex buffers with nk_convert().
+ *
+ * Rather than issuing one raylib draw call per Nuklear command, the whole frame is tessellated
+ * into persistent vertex and index buffers, and then submitted as triangles grouped by texture
+ * and clip rectangle. Requires `RAYLIB_NUKLEAR_USE_VERTEX_BUFFER` to be defined, otherwise it
+ * falls back to DrawNuklear().
+ *
+ * @param ctx The nuklear context.
+ *
+ * @code
+ * #define RAYLIB_NUKLEAR_USE_VERTEX_BUFFER
+ * #define RAYLIB_NUKLEAR_IMPLEMENTATION
+ * #include "raylib-nuklear.h"
+ * DrawNuklearBatched(ctx);
+ * @endcode
+ */
+NK_API void
+DrawNuklearBatched(struct nk_context * ctx)
+{
+    DrawNuklearEx(ctx, NUKLEAR_DRAW_BATCHED);
 }
 
 /**
@@ -1065,15 +7223,78 @@ nk_raylib_input_mouse(struct nk_context * ctx)
     }
 }
 
+/**
+ * Check whether the input that was given to Nuklear this frame could change the GUI.
+ *
+ * Covers mouse motion, mouse button presses and releases, held mouse buttons (drags and repeating buttons),
+ * the mouse wheel, typed characters and key presses and releases.
+ *
+ * @param ctx The nuklear context.
+ *
+ * @return True when there was input activity.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_input_activity(struct nk_context * ctx)
+{
+    const struct nk_input* in = &ctx->input;
+    if (in->mouse.delta.x != 0.0f || in->mouse.delta.y != 0.0f ||
+            in->mouse.scroll_delta.x != 0.0f || in->mouse.scroll_delta.y != 0.0f ||
+            in->mouse.grabbed || in->keyboard.text_len > 0) {
+        return true;
+    }
+
+    for (int i = 0; i < NK_BUTTON_MAX; i++) {
+        if (in->mouse.buttons[i].clicked || in->mouse.buttons[i].down) {
+            return true;
+        }
+    }
+
+    for (int i = 0; i < NK_KEY_MAX; i++) {
+        if (in->keyboard.keys[i].clicked) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * Check whether any Nuklear window is animating without input, like an auto-hiding scrollbar counting down.
+ *
+ * @param ctx The nuklear context.
+ *
+ * @return True when a window is animating.
+ *
+ * @internal
+ */
+static bool
+raylib_nuklear_animating(struct nk_context * ctx)
+{
+    for (struct nk_window* win = ctx->begin; win != NULL; win = win->next) {
+        if ((win->flags & NK_WINDOW_SCROLL_AUTO_HIDE) && !(win->flags & (NK_WINDOW_HIDDEN | NK_WINDOW_CLOSED)) &&
+                win->scrollbar_hiding_timer < NK_SCROLLBAR_HIDING_TIMEOUT) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 /**
  * Update the Nuklear context for raylib's state.
  *
  * @param ctx The nuklear context to act upon.
+ *
+ * @return True when there was input activity that could change the GUI.
+ *
+ * @see UpdateNuklearEx()
  */
-NK_API void
+NK_API bool
 UpdateNuklear(struct nk_context * ctx)
 {
-    UpdateNuklearEx(ctx, GetFrameTime());
+    return UpdateNuklearEx(ctx, GetFrameTime());
 }
 
 /**
@@ -1081,13 +7302,18 @@ UpdateNuklear(struct nk_context * ctx)
  *
  * @param ctx The nuklear context to act upon.
  * @param deltaTime Time in seconds since last frame.
+ *
+ * @return True when there was input activity that could change the GUI: mouse motion, button presses, releases and
+ *         drags, the mouse wheel, typed characters, or key presses and releases.
+ *
+ * @see ShouldNuklearRedraw()
  */
-NK_API void
+NK_API bool
 UpdateNuklearEx(struct nk_context * ctx, float deltaTime)
 {
     // Skip updating if it's not set.
     if (ctx == NULL) {
-        return;
+        return false;
     }
 
     // Update the time that has changed since last frame.
@@ -1100,6 +7326,68 @@ UpdateNuklearEx(struct nk_context * ctx, float deltaTime)
         nk_raylib_input_keyboard(ctx);
     }
     nk_input_end(ctx);
+
+    bool active = raylib_nuklear_input_activity(ctx);
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+    if (userData != NULL) {
+        // Drop the widget states of the windows that nk_clear() freed, for apps that clear frames without drawing them.
+        raylib_nuklear_collect_states(ctx, &userData->states);
+
+        userData->input_active = active;
+        if (active) {
+            userData->redraw_frames = RAYLIB_NUKLEAR_REDRAW_FRAMES;
+        }
+        else if (userData->redraw_frames > 0) {
+            userData->redraw_frames--;
+        }
+    }
+
+    return active;
+}
+
+/**
+ * Check whether the GUI needs to be redrawn, so that apps can idle while it is quiescent.
+ *
+ * Returns true when UpdateNuklear() saw input activity within the last RAYLIB_NUKLEAR_REDRAW_FRAMES updates, when a
+ * window is animating, like an auto-hiding scrollbar, or when the window was resized. Nuklear's text edit caret
+ * does not blink, so a focused text field alone does not need redrawing.
+ *
+ * @param ctx The nuklear context.
+ *
+ * @return True when the GUI should be redrawn.
+ *
+ * @code
+ * while (!WindowShouldClose()) {
+ *     UpdateNuklear(ctx);
+ *     // Build the GUI...
+ *     if (ShouldNuklearRedraw(ctx)) {
+ *         DisableEventWaiting();
+ *     } else {
+ *         EnableEventWaiting(); // EndDrawing() waits for the next input event
+ *     }
+ *     BeginDrawing();
+ *         ClearBackground(RAYWHITE);
+ *         DrawNuklear(ctx);
+ *     EndDrawing();
+ * }
+ * @endcode
+ *
+ * @see UpdateNuklearEx()
+ * @see IsNuklearFrameChanged()
+ */
+NK_API bool
+ShouldNuklearRedraw(struct nk_context * ctx)
+{
+    if (ctx == NULL) {
+        return false;
+    }
+
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+    if (userData == NULL) {
+        return true;
+    }
+
+    return userData->input_active || userData->redraw_frames > 0 || raylib_nuklear_animating(ctx) || IsWindowResized();
 }
 
 /**
@@ -1111,37 +7399,390 @@ NK_API void
 UnloadNuklear(struct nk_context * ctx)
 {
     struct nk_user_font* userFont;
+    NuklearUserData* userData;
+    unsigned char* arena = NULL;
+    size_t arenaHeader = 0;
 
     // Skip unloading if it's not set.
     if (ctx == NULL) {
         return;
     }
 
-    // Unload the font.
+    userData = (NuklearUserData*)ctx->userdata.ptr;
+    if (userData != NULL) {
+        arena = (unsigned char*)userData->arena;
+        arenaHeader = userData->arena_header;
+    }
+
+    // Unload the font, unless it's from the font registry, which is unloaded below, or lives in the fixed memory.
     userFont = (struct nk_user_font*)ctx->style.font;
     if (userFont != NULL) {
-        // Clear the raylib Font object.
-        void* fontPtr = userFont->userdata.ptr;
-        if (fontPtr != NULL) {
-            MemFree(fontPtr);
+        bool inArena = arena != NULL && (unsigned char*)userFont >= arena && (unsigned char*)userFont < arena + arenaHeader;
+        if (!inArena && (userData == NULL || raylib_nuklear_find_registered_font(userData, userFont) == NULL)) {
+            UnloadNuklearFont(userFont);
         }
-
-        // Clear the user font.
-        MemFree(userFont);
         ctx->style.font = NULL;
     }
 
     // Unload the custom user data.
-    if (ctx->userdata.ptr != NULL) {
-        MemFree(ctx->userdata.ptr);
+    if (userData != NULL) {
+        MemFree(userData->polygon_scratch);
+        SetNuklearWindowCache(ctx, false);
+        SetNuklearSDFShapes(ctx, false);
+        SetNuklearAtlas(ctx, false);
+        raylib_nuklear_unload_font_registry(userData);
+        raylib_nuklear_unload_wrap_cache(userData);
+        raylib_nuklear_unload_text_runs(&userData->text_runs);
+        raylib_nuklear_unload_states(&userData->states);
+        MemFree(userData->hash_memo.entries);
+        MemFree(userData->hash_memo.copies);
+#ifdef RAYLIB_NUKLEAR_USE_VERTEX_BUFFER
+        nk_buffer_free(&userData->commands);
+        nk_buffer_free(&userData->vertices);
+        nk_buffer_free(&userData->elements);
+#endif
     }
 
-    // Unload the nuklear context.
+    // Unload the nuklear context, which frees its memory through the user data's allocator.
     nk_free(ctx);
-    MemFree(ctx);
+    if (userData != NULL) {
+        if (userData->memory.live > 0) {
+            TraceLog(LOG_WARNING, "NUKLEAR: %i bytes are still allocated, from text edits that weren't freed", (int)userData->memory.live);
+        }
+        if (arena == NULL) {
+            MemFree(userData);
+        }
+    }
+
+    // The fixed memory belongs to the caller.
+    if (arena == NULL) {
+        MemFree(ctx);
+    }
     TraceLog(LOG_INFO, "NUKLEAR: Unloaded GUI");
 }
 
+/**
+ * Enable or disable caching windows in render textures for DrawNuklear().
+ *
+ * When enabled, each window's command stream is hashed every frame. Windows whose commands are unchanged are drawn
+ * from a render texture instead of replaying their commands, and windows that moved, resized or changed are
+ * rendered into their cache again. Closed windows are evicted. Windows with an open popup or custom commands
+ * are always drawn directly. Images are cached by their texture id, so windows showing textures whose contents
+ * change every frame should not rely on this. Disabling the cache unloads all of its render textures.
+ *
+ * @param ctx The nuklear context.
+ * @param enabled Whether to cache windows.
+ *
+ * @see GetNuklearRenderStats()
+ */
+NK_API void
+SetNuklearWindowCache(struct nk_context * ctx, bool enabled)
+{
+    if (ctx == NULL) {
+        return;
+    }
+
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+    if (userData == NULL) {
+        return;
+    }
+
+    userData->window_cache_enabled = enabled;
+    if (!enabled) {
+        for (int i = 0; i < userData->window_cache_count; i++) {
+            if (userData->window_cache[i].target.id != 0) {
+                UnloadRenderTexture(userData->window_cache[i].target);
+            }
+        }
+        MemFree(userData->window_cache);
+        userData->window_cache = NULL;
+        userData->window_cache_count = 0;
+        userData->window_cache_capacity = 0;
+    }
+}
+
+/**
+ * Enable or disable drawing shapes with a signed distance field shader in DrawNuklear().
+ *
+ * When enabled, rounded rectangles, circles and arcs are drawn as a few antialiased quads each, evaluated by a
+ * fragment shader, instead of being tessellated into many triangles. The shader passes text and images through
+ * like raylib's default shader, so the whole GUI is drawn with it and still batches. Shaders aren't available on
+ * OpenGL 1.1 or raylib's software renderer, in which case the shapes keep being tessellated.
+ *
+ * @param ctx The nuklear context.
+ * @param enabled Whether to draw shapes with the shader.
+ *
+ * @return True when the shader is in use.
+ */
+NK_API bool
+SetNuklearSDFShapes(struct nk_context * ctx, bool enabled)
+{
+    if (ctx == NULL) {
+        return false;
+    }
+
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+    if (userData == NULL) {
+        return false;
+    }
+
+    if (enabled && userData->sdf_shader.id == 0) {
+        userData->sdf_shader = raylib_nuklear_load_sdf_shader(raylib_nuklear_sdf_vs, raylib_nuklear_sdf_fs);
+        if (userData->sdf_shader.id == 0) {
+            TraceLog(LOG_WARNING, "NUKLEAR: Shaders are unavailable, drawing shapes without the SDF shader");
+        }
+    }
+    else if (!enabled && userData->sdf_shader.id != 0) {
+        UnloadShader(userData->sdf_shader);
+        userData->sdf_shader = CLITERAL(Shader) {0};
+    }
+
+    return userData->sdf_shader.id != 0;
+}
+
+/**
+ * Enable or disable the texture atlas for DrawNuklear().
+ *
+ * When enabled, the font, a white texel that shapes are drawn with, and the textures registered with
+ * AddNuklearAtlasTexture() are packed into shared texture pages, so that text, shapes and icons draw without switching
+ * textures and stay in one raylib batch. Textures are packed when they're first drawn, and ones that go unused for
+ * RAYLIB_NUKLEAR_ATLAS_EVICT_FRAMES frames make room for others when the atlas is full. Anything that doesn't fit is
+ * drawn from its own texture. DrawNuklearBatched() isn't affected.
+ *
+ * @param ctx The nuklear context.
+ * @param enabled Whether to use the texture atlas.
+ *
+ * @return True when the texture atlas is in use.
+ */
+NK_API bool
+SetNuklearAtlas(struct nk_context * ctx, bool enabled)
+{
+    if (ctx == NULL) {
+        return false;
+    }
+
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+    if (userData == NULL) {
+        return false;
+    }
+
+    if (enabled && userData->atlas == NULL) {
+        userData->atlas = (NuklearAtlas*)MemAlloc((unsigned int)sizeof(NuklearAtlas));
+        if (userData->atlas == NULL) {
+            TraceLog(LOG_WARNING, "NUKLEAR: Failed to allocate the texture atlas");
+            return false;
+        }
+        nk_memset(userData->atlas, 0, sizeof(NuklearAtlas));
+    }
+    else if (!enabled && userData->atlas != NULL) {
+        NuklearAtlas* atlas = userData->atlas;
+        for (int i = 0; i < atlas->pageCount; i++) {
+            UnloadTexture(atlas->pages[i].texture);
+            UnloadImage(atlas->pages[i].image);
+        }
+        for (int i = 0; i < atlas->imageCount; i++) {
+            UnloadImage(atlas->images[i].image);
+        }
+        MemFree(atlas->images);
+        raylib_nuklear_atlas_unload_font(atlas);
+        MemFree(atlas);
+        userData->atlas = NULL;
+    }
+
+    return userData->atlas != NULL;
+}
+
+/**
+ * Register a texture to be drawn from the texture atlas, like an icon used with TextureToNuklearImage().
+ *
+ * Images keep referring to the texture itself, and are drawn from the atlas once it's packed there, so they don't
+ * need to change. The texture's pixels are copied, so update it by removing and adding it again.
+ *
+ * @param ctx The nuklear context, with the texture atlas enabled through SetNuklearAtlas().
+ * @param texture The texture, at most RAYLIB_NUKLEAR_ATLAS_MAX_IMAGE_SIZE pixels wide and high.
+ *
+ * @return True when the texture is registered.
+ */
+NK_API bool
+AddNuklearAtlasTexture(struct nk_context * ctx, Texture texture)
+{
+    if (ctx == NULL || ctx->userdata.ptr == NULL || texture.id == 0) {
+        return false;
+    }
+
+    NuklearAtlas* atlas = ((NuklearUserData*)ctx->userdata.ptr)->atlas;
+    if (atlas == NULL) {
+        TraceLog(LOG_WARNING, "NUKLEAR: Enable the texture atlas with SetNuklearAtlas() before adding textures to it");
+        return false;
+    }
+    if (raylib_nuklear_atlas_find(atlas, texture.id) != NULL) {
+        return true;
+    }
+    if (texture.width <= 0 || texture.height <= 0 || texture.width > RAYLIB_NUKLEAR_ATLAS_MAX_IMAGE_SIZE || texture.height > RAYLIB_NUKLEAR_ATLAS_MAX_IMAGE_SIZE) {
+        TraceLog(LOG_WARNING, "NUKLEAR: Texture %u is too large for the texture atlas", texture.id);
+        return false;
+    }
+
+    if (atlas->imageCount == atlas->imageCapacity) {
+        int capacity = (atlas->imageCapacity == 0) ? 16 : atlas->imageCapacity * 2;
+        NuklearAtlasImage* grown = (NuklearAtlasImage*)MemRealloc(atlas->images, (unsigned int)((size_t)capacity * sizeof(NuklearAtlasImage)));
+        if (grown == NULL) {
+            return false;
+        }
+        atlas->images = grown;
+        atlas->imageCapacity = capacity;
+    }
+
+    Image image = raylib_nuklear_atlas_load_image(texture);
+    if (image.data == NULL) {
+        TraceLog(LOG_WARNING, "NUKLEAR: Failed to read texture %u for the texture atlas", texture.id);
+        return false;
+    }
+
+    NuklearAtlasImage* entry = &atlas->images[atlas->imageCount++];
+    entry->texture = texture.id;
+    entry->image = image;
+    entry->page = -1;
+    entry->region = CLITERAL(Rectangle) {0};
+    entry->frame = atlas->frame;
+    entry->wanted = false;
+    return true;
+}
+
+/**
+ * Stop drawing the given texture from the texture atlas. Call this before unloading a registered texture.
+ *
+ * @param ctx The nuklear context.
+ * @param texture The texture that was given to AddNuklearAtlasTexture().
+ */
+NK_API void
+RemoveNuklearAtlasTexture(struct nk_context * ctx, Texture texture)
+{
+    if (ctx == NULL || ctx->userdata.ptr == NULL) {
+        return;
+    }
+
+    NuklearAtlas* atlas = ((NuklearUserData*)ctx->userdata.ptr)->atlas;
+    NuklearAtlasImage* entry = raylib_nuklear_atlas_find(atlas, texture.id);
+    if (entry != NULL) {
+        // Its pixels stay in the atlas until it's repacked.
+        UnloadImage(entry->image);
+        *entry = atlas->images[--atlas->imageCount];
+    }
+}
+
+/**
+ * Get the rendering statistics from the last DrawNuklear() call.
+ *
+ * @param ctx The nuklear context.
+ *
+ * @return The rendering statistics, or empty statistics when they aren't available.
+ */
+NK_API NuklearRenderStats
+GetNuklearRenderStats(struct nk_context * ctx)
+{
+    if (ctx == NULL || ctx->userdata.ptr == NULL) {
+        return CLITERAL(NuklearRenderStats) {0};
+    }
+
+    return ((NuklearUserData*)ctx->userdata.ptr)->stats;
+}
+
+/**
+ * Get how much memory the given Nuklear context uses.
+ *
+ * Contexts from InitNuklearFixed() report how much of their memory is used. All other contexts report what they
+ * allocated through their NuklearAllocator, in total and for each NuklearMemorySource.
+ *
+ * @param ctx The nuklear context.
+ *
+ * @return The memory statistics, or empty statistics when they aren't available.
+ *
+ * @see InitNuklearFixed()
+ * @see InitNuklearWithAllocator()
+ */
+NK_API NuklearMemoryStats
+GetNuklearMemoryStats(struct nk_context * ctx)
+{
+    NuklearMemoryStats stats = {0};
+    if (ctx == NULL || ctx->userdata.ptr == NULL) {
+        return stats;
+    }
+
+    NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+    if (userData->arena != NULL) {
+        raylib_nuklear_track_arena(ctx, userData);
+        stats.arenaSize = userData->arena_size;
+        stats.arenaUsed = userData->arena_header + ctx->memory.allocated + (ctx->memory.memory.size - ctx->memory.size);
+        stats.arenaPeak = userData->arena_peak;
+        stats.arenaOverflow = userData->arena_overflow;
+    }
+
+    const NuklearMemoryTracker* tracker = &userData->memory;
+    stats.liveBytes = tracker->live;
+    stats.peakBytes = tracker->peak;
+    stats.allocations = tracker->allocations;
+    stats.reallocations = tracker->reallocations;
+    stats.inPlaceReallocations = tracker->inPlaceReallocations;
+    stats.frameAllocations = tracker->frameAllocations;
+    stats.commandBufferSize = ctx->memory.memory.size;
+    stats.commandBufferTarget = userData->commands_plan.target;
+    for (int i = 0; i < NUKLEAR_MEMORY_SOURCE_COUNT; i++) {
+        stats.sourceBytes[i] = tracker->sourceBytes[i];
+        stats.sourceAllocations[i] = tracker->sourceAllocations[i];
+    }
+    return stats;
+}
+
+/**
+ * Prewarm Nuklear's command buffer for a GUI that's known to be heavy, so the first frames don't grow it.
+ *
+ * The command buffer also won't shrink below the given size. Outside of a frame, it's resized right away, otherwise
+ * once the frame is drawn. Contexts from InitNuklearFixed() can't be resized.
+ *
+ * @param ctx The nuklear context.
+ * @param size The least capacity of the command buffer, in bytes. Use 0 to let it shrink to the demand again.
+ *
+ * @see SetNuklearCommandBufferShrinkFrames()
+ */
+NK_API void
+ReserveNuklearCommandBuffer(struct nk_context * ctx, nk_size size)
+{
+    if (ctx == NULL || ctx->userdata.ptr == NULL) {
+        return;
+    }
+
+    NuklearCommandPlanner* plan = &((NuklearUserData*)ctx->userdata.ptr)->commands_plan;
+    plan->reserved = size;
+    plan->target = NK_MAX(plan->target, size);
+    if (ctx->memory.memory.size < size) {
+        raylib_nuklear_resize_commands(ctx, size);
+    }
+}
+
+/**
+ * Set how many drawn frames Nuklear's command buffer has to be more than twice as large as planned before it shrinks.
+ *
+ * The capacity is planned from the RAYLIB_NUKLEAR_COMMAND_PERCENTILE of the command buffer's demand in the last
+ * RAYLIB_NUKLEAR_COMMAND_HISTORY frames, so that a transient spike like a large popup doesn't keep it large.
+ *
+ * @param ctx The nuklear context.
+ * @param frames The amount of frames, or 0 to never shrink the command buffer. Defaults to RAYLIB_NUKLEAR_COMMAND_SHRINK_FRAMES.
+ *
+ * @see ReserveNuklearCommandBuffer()
+ */
+NK_API void
+SetNuklearCommandBufferShrinkFrames(struct nk_context * ctx, unsigned int frames)
+{
+    if (ctx == NULL || ctx->userdata.ptr == NULL) {
+        return;
+    }
+
+    NuklearCommandPlanner* plan = &((NuklearUserData*)ctx->userdata.ptr)->commands_plan;
+    plan->shrinkFrames = frames;
+    plan->quietFrames = 0;
+}
+
 /**
  * Convert the given Nuklear rectangle to a raylib Rectangle.
  */
@@ -1225,6 +7866,7 @@ SetNuklearScaling(struct nk_context * ctx, float scaling)
     struct NuklearUserData* userData = (struct NuklearUserData*)ctx->userdata.ptr;
     if (userData != NULL) {
         userData->scaling = scaling;
+        raylib_nuklear_bake_registered_fonts(userData);
     }
 }
 
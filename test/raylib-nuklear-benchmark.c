@@ -0,0 +1,485 @@
+#include <stdio.h>
+
+#include "raylib.h"
+
+#define RAYLIB_NUKLEAR_USE_VERTEX_BUFFER
+#define RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT
+#define RAYLIB_NUKLEAR_IMPLEMENTATION
+#include "raylib-nuklear.h"
+
+#include "raylib-assert.h"
+
+#define BENCHMARK_FRAMES 120
+
+/**
+ * The vertical scroll offset of the dense scene's panels.
+ */
+static nk_uint denseSceneScroll = 0;
+
+/**
+ * Build a dense tool panel, with a lot of widgets across a few windows.
+ */
+static void BuildDenseScene(struct nk_context* ctx) {
+    static float slider = 0.5f;
+    static nk_size progress = 40;
+    static nk_bool check = nk_true;
+
+    for (int w = 0; w < 3; w++) {
+        const char* title = TextFormat("Panel %i", w);
+        if (nk_begin(ctx, title, nk_rect(10.0f + (float)w * 210.0f, 10, 200, 460),
+                NK_WINDOW_BORDER|NK_WINDOW_TITLE|NK_WINDOW_MOVABLE)) {
+            nk_window_set_scroll(ctx, 0, denseSceneScroll);
+            for (int i = 0; i < 40; i++) {
+                nk_layout_row_dynamic(ctx, 18, 3);
+                nk_button_label(ctx, "Button");
+                nk_label(ctx, "Label", NK_TEXT_LEFT);
+                nk_checkbox_label(ctx, "Check", &check);
+                nk_layout_row_dynamic(ctx, 18, 2);
+                nk_slider_float(ctx, 0.0f, &slider, 1.0f, 0.01f);
+                nk_progress(ctx, &progress, 100, nk_true);
+            }
+        }
+        nk_end(ctx);
+    }
+}
+
+/**
+ * Time the given renderer over BENCHMARK_FRAMES frames, returning the average CPU milliseconds per frame spent drawing.
+ */
+static double BenchmarkRenderer(struct nk_context* ctx, void (*draw)(struct nk_context*)) {
+    double total = 0.0;
+    for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+        UpdateNuklearEx(ctx, 1.0f / 60.0f);
+        BuildDenseScene(ctx);
+
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            double start = GetTime();
+            draw(ctx);
+            total += GetTime() - start;
+        EndDrawing();
+    }
+    return total * 1000.0 / BENCHMARK_FRAMES;
+}
+
+/**
+ * Zoom the dense scene from 1x to 3x scaling over BENCHMARK_FRAMES frames with the given font, returning the average
+ * CPU milliseconds per frame spent scaling and drawing, and how many bytes of font atlases were made along the way.
+ */
+static double BenchmarkZoom(struct nk_context* ctx, const struct nk_user_font* font, size_t* atlasBytes) {
+    double total = 0.0;
+    unsigned int texture = 0;
+    *atlasBytes = 0;
+    for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+        double start = GetTime();
+        SetNuklearScaling(ctx, 1.0f + 2.0f * (float)frame / (float)(BENCHMARK_FRAMES - 1));
+        total += GetTime() - start;
+
+        // Count each atlas that the font was baked into.
+        const Font* raylibFont = (const Font*)font->userdata.ptr;
+        if (raylibFont->texture.id != texture) {
+            texture = raylibFont->texture.id;
+            *atlasBytes += (size_t)GetPixelDataSize(raylibFont->texture.width, raylibFont->texture.height, raylibFont->texture.format);
+        }
+
+        UpdateNuklearEx(ctx, 1.0f / 60.0f);
+        nk_style_push_font(ctx, font);
+        BuildDenseScene(ctx);
+        nk_style_pop_font(ctx);
+
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            start = GetTime();
+            DrawNuklear(ctx);
+            total += GetTime() - start;
+        EndDrawing();
+    }
+    return total * 1000.0 / BENCHMARK_FRAMES;
+}
+
+/**
+ * Lay out a help pane of wrapped paragraphs over BENCHMARK_FRAMES frames with the given wrapped label function,
+ * returning the average CPU milliseconds per frame spent building the GUI.
+ */
+static double BenchmarkWrap(struct nk_context* ctx, void (*wrap)(struct nk_context*, const char*)) {
+    static char paragraph[2048 + 1];
+    for (int i = 0; i < 2048; i++) {
+        paragraph[i] = "The quick brown fox jumps over the lazy dog. "[i % 45];
+    }
+    paragraph[2048] = '\0';
+
+    double total = 0.0;
+    for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+        UpdateNuklearEx(ctx, 1.0f / 60.0f);
+        double start = GetTime();
+        if (nk_begin(ctx, "Help", nk_rect(0, 0, 400, 600), NK_WINDOW_BORDER)) {
+            for (int i = 0; i < 8; i++) {
+                nk_layout_row_dynamic(ctx, 400, 1);
+                wrap(ctx, paragraph);
+            }
+        }
+        nk_end(ctx);
+        total += GetTime() - start;
+        nk_clear(ctx);
+    }
+    return total * 1000.0 / BENCHMARK_FRAMES;
+}
+
+/**
+ * Draw a wide log view over BENCHMARK_FRAMES frames, whose rows mostly reach past the window, returning the CPU
+ * milliseconds of the first frame, which lays its text out, and the average of the following frames.
+ */
+static double BenchmarkLogView(struct nk_context* ctx, double* firstFrame) {
+    static char row[400 + 1];
+    for (int i = 0; i < 400; i++) {
+        row[i] = "12:00:00 INFO The quick brown fox jumps over the lazy dog. "[i % 59];
+    }
+    row[400] = '\0';
+
+    double total = 0.0;
+    for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+        UpdateNuklearEx(ctx, 1.0f / 60.0f);
+        if (nk_begin(ctx, "Log", nk_rect(10, 10, 300, 460), NK_WINDOW_BORDER)) {
+            nk_layout_row_static(ctx, 12, 2400, 1);
+            for (int i = 0; i < 36; i++) {
+                nk_label(ctx, row, NK_TEXT_LEFT);
+            }
+        }
+        nk_end(ctx);
+
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            double start = GetTime();
+            DrawNuklear(ctx);
+            double elapsed = GetTime() - start;
+        EndDrawing();
+        if (frame == 0) {
+            *firstFrame = elapsed * 1000.0;
+        } else {
+            total += elapsed;
+        }
+    }
+    return total * 1000.0 / (BENCHMARK_FRAMES - 1);
+}
+
+/**
+ * Persist the given amount of widget states in a window, both in Nuklear's value tables and in the hash index of
+ * nk_raylib_tree_push(), and return the average nanoseconds per lookup of either.
+ */
+static void BenchmarkStateLookup(int count, double* tables, double* hashed) {
+    struct nk_context* ctx = InitNuklear(10);
+    Assert(ctx);
+    NuklearStateIndex* states = &((NuklearUserData*)ctx->userdata.ptr)->states;
+    Assert(nk_begin(ctx, "States", nk_rect(0, 0, 100, 100), 0));
+    struct nk_window* win = ctx->current;
+    for (int i = 0; i < count; i++) {
+        nk_hash id = (nk_hash)i * 2654435761u + 1u;
+        Assert(nk_add_value(ctx, win, id, (nk_uint)i));
+        Assert(raylib_nuklear_add_state(states, win->name, id));
+    }
+
+    const int lookups = 200;
+    nk_uint found = 0;
+    double start = GetTime();
+    for (int i = 0; i < lookups; i++) {
+        found += *nk_find_value(win, (nk_hash)((i * 7919) % count) * 2654435761u + 1u);
+    }
+    *tables = (GetTime() - start) * 1e9 / lookups;
+
+    start = GetTime();
+    for (int i = 0; i < lookups; i++) {
+        found += raylib_nuklear_find_state(states, win->name, (nk_hash)((i * 7919) % count) * 2654435761u + 1u)->values[0];
+    }
+    *hashed = (GetTime() - start) * 1e9 / lookups;
+    Assert(found < 0xFFFFFFFFu);
+
+    nk_end(ctx);
+    nk_clear(ctx);
+    UnloadNuklear(ctx);
+}
+
+int main(int argc, char *argv[]) {
+    // Initialization
+    SetTraceLogLevel(LOG_INFO);
+    InitWindow(640, 480, "raylib-nuklear-benchmark");
+    Assert(IsWindowReady());
+
+    // Make sure we're running in the correct directory.
+    Assert(argc > 0);
+    const char* dir = GetDirectoryPath(argv[0]);
+    Assert(ChangeDirectory(dir));
+
+    // DrawNuklear() vs DrawNuklearBatched()
+    {
+        struct nk_context* ctx = InitNuklear(10);
+        Assert(ctx);
+        double immediate = BenchmarkRenderer(ctx, DrawNuklear);
+        double batched = BenchmarkRenderer(ctx, DrawNuklearBatched);
+        TraceLog(LOG_INFO, "BENCHMARK: DrawNuklear():        %.3f ms/frame", immediate);
+        TraceLog(LOG_INFO, "BENCHMARK: DrawNuklearBatched(): %.3f ms/frame", batched);
+        UnloadNuklear(ctx);
+    }
+
+    // Draw calls and batch flushes of scrolled lists
+    {
+        struct nk_context* ctx = InitNuklear(10);
+        Assert(ctx);
+        denseSceneScroll = 400;
+        BenchmarkRenderer(ctx, DrawNuklear);
+        denseSceneScroll = 0;
+        NuklearRenderStats stats = GetNuklearRenderStats(ctx);
+        TraceLog(LOG_INFO, "BENCHMARK: DrawNuklear() draw calls: %u, culled: %u, skipped scissors: %u, batch flushes: %u, texture switches: %u",
+            stats.drawCalls, stats.culledCommands, stats.skippedScissors, stats.batchFlushes, stats.textureSwitches);
+        UnloadNuklear(ctx);
+    }
+
+    // The first dense frame growing the command buffer, vs prewarmed with ReserveNuklearCommandBuffer()
+    {
+        for (int prewarm = 0; prewarm < 2; prewarm++) {
+            struct nk_context* ctx = InitNuklear(10);
+            Assert(ctx);
+            if (prewarm) {
+                ReserveNuklearCommandBuffer(ctx, 512 * 1024);
+            }
+            UpdateNuklearEx(ctx, 1.0f / 60.0f);
+            NuklearMemoryStats before = GetNuklearMemoryStats(ctx);
+            double start = GetTime();
+            BuildDenseScene(ctx);
+            double elapsed = (GetTime() - start) * 1000.0;
+            NuklearMemoryStats after = GetNuklearMemoryStats(ctx);
+            TraceLog(LOG_INFO, "BENCHMARK: Building the first dense frame%s: %.3f ms, %u command buffer reallocations",
+                prewarm ? " after ReserveNuklearCommandBuffer()" : "", elapsed, after.reallocations - before.reallocations);
+            nk_clear(ctx);
+            UnloadNuklear(ctx);
+        }
+    }
+
+    // The command buffer after a one-frame spike, like a large popup
+    {
+        struct nk_context* ctx = InitNuklear(10);
+        Assert(ctx);
+        SetNuklearCommandBufferShrinkFrames(ctx, 30);
+        nk_size spike = 0;
+        for (int frame = 0; frame < BENCHMARK_FRAMES; frame++) {
+            UpdateNuklearEx(ctx, 1.0f / 60.0f);
+            if (frame == 0) {
+                BuildDenseScene(ctx);
+            }
+            else {
+                if (nk_begin(ctx, "Quiet", nk_rect(10, 10, 200, 100), 0)) {
+                    nk_layout_row_dynamic(ctx, 18, 1);
+                    nk_label(ctx, "Label", NK_TEXT_LEFT);
+                }
+                nk_end(ctx);
+            }
+            BeginDrawing();
+                ClearBackground(RAYWHITE);
+                DrawNuklear(ctx);
+            EndDrawing();
+            if (frame == 0) {
+                spike = GetNuklearMemoryStats(ctx).commandBufferSize;
+            }
+        }
+        TraceLog(LOG_INFO, "BENCHMARK: Command buffer after a spike: %i KB, %i KB after %i quiet frames",
+            (int)(spike / 1024), (int)(GetNuklearMemoryStats(ctx).commandBufferSize / 1024), BENCHMARK_FRAMES - 1);
+        UnloadNuklear(ctx);
+    }
+
+    // Looking up persisted tree and group states in Nuklear's value tables, vs the hash index of nk_raylib_tree_push()
+    {
+        const int counts[] = { 10000, 100000, 1000000 };
+        for (int i = 0; i < 3; i++) {
+            double tables = 0.0;
+            double hashed = 0.0;
+            BenchmarkStateLookup(counts[i], &tables, &hashed);
+            TraceLog(LOG_INFO, "BENCHMARK: Finding one of %i states: nk_find_value(): %.0f ns, hash index: %.0f ns", counts[i], tables, hashed);
+        }
+    }
+
+    // Hashing widget IDs: nk_murmur_hash() vs raylib_nuklear_hash_id(), and its memo of repeated IDs within a frame
+    {
+        // Eight IDs that start at different addresses, so the compiler can't hash them once for all iterations.
+        static char id[256 + 8 + 1];
+        for (int i = 0; i < 256 + 8; i++) {
+            id[i] = "examples/raylib-nuklear-demo.c:1234 "[i % 36];
+        }
+        id[256 + 8] = '\0';
+
+        NuklearHashMemo memo = {0};
+        memo.frame = 1;
+        const int lengths[] = { 6, 36, 128, 256 };
+        const int iterations = 200000;
+        for (int l = 0; l < 4; l++) {
+            int len = lengths[l];
+            nk_hash sink = 0;
+            double start = GetTime();
+            for (int i = 0; i < iterations; i++) {
+                sink ^= nk_murmur_hash(id + (i & 7), len, (nk_hash)i);
+            }
+            double murmur = (GetTime() - start) * 1e9 / iterations;
+
+            start = GetTime();
+            for (int i = 0; i < iterations; i++) {
+                sink ^= raylib_nuklear_hash_id(NULL, id + (i & 7), len, (nk_hash)i);
+            }
+            double hashed = (GetTime() - start) * 1e9 / iterations;
+
+            start = GetTime();
+            for (int i = 0; i < iterations; i++) {
+                sink ^= raylib_nuklear_hash_id(&memo, id + (i & 7), len, (nk_hash)i);
+            }
+            double memoized = (GetTime() - start) * 1e9 / iterations;
+            TraceLog(LOG_INFO, "BENCHMARK: Hashing a %i byte ID: nk_murmur_hash(): %.1f ns, raylib_nuklear_hash_id(): %.1f ns, with the memo: %.1f ns (%u)",
+                len, murmur, hashed, memoized, sink & 1u);
+        }
+        MemFree(memo.entries);
+        MemFree(memo.copies);
+    }
+
+    // Text runs of a wide log view, with the glyphs past the window culled
+    {
+        struct nk_context* ctx = InitNuklear(10);
+        Assert(ctx);
+        double first = 0.0;
+        double steady = BenchmarkLogView(ctx, &first);
+        NuklearRenderStats stats = GetNuklearRenderStats(ctx);
+        TraceLog(LOG_INFO, "BENCHMARK: DrawNuklear() of a log view, laying text out: %.3f ms", first);
+        TraceLog(LOG_INFO, "BENCHMARK: DrawNuklear() of a log view, from text runs:  %.3f ms/frame, culled glyphs: %u", steady, stats.culledGlyphs);
+        UnloadNuklear(ctx);
+    }
+
+    // The texture atlas keeps text and shapes on one texture.
+    {
+        struct nk_context* ctx = InitNuklear(10);
+        Assert(ctx);
+        SetNuklearAtlas(ctx, true);
+        BenchmarkRenderer(ctx, DrawNuklear);
+        NuklearRenderStats stats = GetNuklearRenderStats(ctx);
+        TraceLog(LOG_INFO, "BENCHMARK: DrawNuklear() with SetNuklearAtlas() texture switches: %u, batch flushes: %u",
+            stats.textureSwitches, stats.batchFlushes);
+        UnloadNuklear(ctx);
+    }
+
+    // Text width callbacks vs MeasureTextEx() on 10 KB strings
+    {
+        Font font = LoadFont("resources/anonymous_pro_bold.ttf");
+        struct nk_context* ctx = InitNuklearEx(font, 20.0f);
+        Assert(ctx);
+        const struct nk_user_font* userFont = ctx->style.font;
+
+        static char text[10 * 1024 + 1];
+        for (int i = 0; i < 10 * 1024; i++) {
+            text[i] = "The quick brown fox jumps over the lazy dog. "[i % 45];
+        }
+        text[10 * 1024] = '\0';
+
+        const int iterations = 100;
+        float width = 0.0f;
+        double start = GetTime();
+        for (int i = 0; i < iterations; i++) {
+            width += MeasureTextEx(font, text, userFont->height, userFont->height * RAYLIB_NUKLEAR_FONT_SPACING_RATIO).x;
+        }
+        double measure = (GetTime() - start) * 1000.0 / iterations;
+        start = GetTime();
+        for (int i = 0; i < iterations; i++) {
+            width += userFont->width(userFont->userdata, userFont->height, text, 10 * 1024);
+        }
+        double callback = (GetTime() - start) * 1000.0 / iterations;
+        TraceLog(LOG_INFO, "BENCHMARK: MeasureTextEx() on 10 KB:              %.4f ms", measure);
+        TraceLog(LOG_INFO, "BENCHMARK: nk_user_font width() on 10 KB:         %.4f ms", callback);
+
+        // Nuklear clamps labels by measuring ever longer prefixes.
+        start = GetTime();
+        for (int len = 16; len <= 10 * 1024; len += 16) {
+            width += userFont->width(userFont->userdata, userFont->height, text, len);
+        }
+        TraceLog(LOG_INFO, "BENCHMARK: nk_user_font width() of 640 prefixes: %.4f ms (%.0f)", (GetTime() - start) * 1000.0, width);
+
+        UnloadNuklear(ctx);
+        UnloadFont(font);
+    }
+
+    // Wrapped text through nk_label_wrap(), vs from the line-break cache
+    {
+        struct nk_context* ctx = InitNuklear(10);
+        Assert(ctx);
+        double uncached = BenchmarkWrap(ctx, nk_label_wrap);
+        double cached = BenchmarkWrap(ctx, nk_raylib_label_wrap);
+        UnloadNuklear(ctx);
+
+        TraceLog(LOG_INFO, "BENCHMARK: nk_label_wrap() of 8 paragraphs:        %.3f ms/frame", uncached);
+        TraceLog(LOG_INFO, "BENCHMARK: nk_raylib_label_wrap() of 8 paragraphs: %.3f ms/frame", cached);
+    }
+
+    // Startup with the default Nuklear font: decoding and baking it, vs loading it again from the baked cache
+    {
+        double start = GetTime();
+        Font font = LoadFontFromNuklear(0);
+        struct nk_context* ctx = InitNuklearEx(font, 0.0f);
+        double cold = (GetTime() - start) * 1000.0;
+        Assert(ctx);
+        UnloadNuklear(ctx);
+        UnloadFont(font);
+
+        start = GetTime();
+        font = LoadFontFromNuklear(0);
+        ctx = InitNuklearEx(font, 0.0f);
+        double warm = (GetTime() - start) * 1000.0;
+        Assert(ctx);
+        Assert(font.glyphCount > 0);
+        UnloadNuklear(ctx);
+        UnloadFont(font);
+
+        TraceLog(LOG_INFO, "BENCHMARK: LoadFontFromNuklear() + InitNuklearEx(), first: %.3f ms", cold);
+        TraceLog(LOG_INFO, "BENCHMARK: LoadFontFromNuklear() + InitNuklearEx(), again: %.3f ms", warm);
+        UnloadNuklearDefaultFontCache();
+    }
+
+    // Loading fonts by baking them, vs from the font cache
+    {
+        const char* cacheFile = "raylib-nuklear-benchmark-fonts.cache";
+        char empty[1] = {0};
+        SaveFileData(cacheFile, empty, 0);
+        const int sizes[] = {12, 14, 16, 20, 24, 32};
+        double start = GetTime();
+        for (int i = 0; i < 6; i++) {
+            UnloadFont(LoadFontFromNuklearCache(cacheFile, "resources/anonymous_pro_bold.ttf", sizes[i], NULL, 0));
+        }
+        double baked = (GetTime() - start) * 1000.0;
+        start = GetTime();
+        for (int i = 0; i < 6; i++) {
+            Font font = LoadFontFromNuklearCache(cacheFile, "resources/anonymous_pro_bold.ttf", sizes[i], NULL, 0);
+            Assert(font.glyphCount > 0);
+            UnloadFont(font);
+        }
+        double cached = (GetTime() - start) * 1000.0;
+        TraceLog(LOG_INFO, "BENCHMARK: LoadFontFromNuklearCache() of 6 sizes, baked:  %.3f ms", baked);
+        TraceLog(LOG_INFO, "BENCHMARK: LoadFontFromNuklearCache() of 6 sizes, cached: %.3f ms", cached);
+        remove(cacheFile);
+    }
+
+    // Zooming with a font baked at every scaling vs a signed distance field font
+    {
+        struct nk_context* ctx = InitNuklear(10);
+        Assert(ctx);
+        size_t bitmapBytes = 0;
+        double bitmap = BenchmarkZoom(ctx, GetNuklearFont(ctx, "resources/anonymous_pro_bold.ttf", 20.0f), &bitmapBytes);
+        UnloadNuklear(ctx);
+
+        ctx = InitNuklear(10);
+        Assert(ctx);
+        struct nk_user_font* sdfFont = LoadNuklearSDFFont("resources/anonymous_pro_bold.ttf", 20.0f);
+        Assert(sdfFont);
+        size_t sdfBytes = 0;
+        double sdf = BenchmarkZoom(ctx, sdfFont, &sdfBytes);
+        UnloadNuklear(ctx);
+        UnloadNuklearFont(sdfFont);
+
+        TraceLog(LOG_INFO, "BENCHMARK: Zoom with GetNuklearFont() bitmaps: %.3f ms/frame, %zu KB of atlases", bitmap, bitmapBytes / 1024);
+        TraceLog(LOG_INFO, "BENCHMARK: Zoom with LoadNuklearSDFFont():     %.3f ms/frame, %zu KB of atlases", sdf, sdfBytes / 1024);
+    }
+
+    CloseWindow();
+
+    return 0;
+}
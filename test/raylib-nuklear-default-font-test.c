@@ -0,0 +1,132 @@
+#include <stdio.h>
+
+#include "raylib.h"
+
+#define RAYLIB_NUKLEAR_INCLUDE_DEFAULT_FONT
+#define RAYLIB_NUKLEAR_IMPLEMENTATION
+#include "raylib-nuklear.h"
+
+#include "raylib-assert.h"
+
+// Check that two fonts were baked the same, without comparing their glyph images.
+static void AssertFontsEqual(Font font, Font other) {
+    AssertEqual(font.baseSize, other.baseSize);
+    AssertEqual(font.glyphCount, other.glyphCount);
+    AssertEqual(font.glyphPadding, other.glyphPadding);
+    for (int i = 0; i < font.glyphCount; i++) {
+        AssertEqual(font.glyphs[i].value, other.glyphs[i].value);
+        AssertEqual(font.glyphs[i].offsetX, other.glyphs[i].offsetX);
+        AssertEqual(font.glyphs[i].offsetY, other.glyphs[i].offsetY);
+        AssertEqual(font.glyphs[i].advanceX, other.glyphs[i].advanceX);
+        AssertEqual(font.recs[i].x, other.recs[i].x);
+        AssertEqual(font.recs[i].y, other.recs[i].y);
+        AssertEqual(font.recs[i].width, other.recs[i].width);
+        AssertEqual(font.recs[i].height, other.recs[i].height);
+    }
+}
+
+int main(int argc, char *argv[]) {
+    // Initialization
+    SetTraceLogLevel(LOG_ALL);
+    TraceLog(LOG_INFO, "================================");
+    TraceLog(LOG_INFO, "raylib-nuklear-default-font-test");
+    TraceLog(LOG_INFO, "================================");
+
+    InitWindow(640, 480, "raylib-nuklear-default-font-tests");
+    Assert(IsWindowReady());
+
+    // Make sure we're running in the correct directory.
+    Assert(argc > 0);
+    const char* dir = GetDirectoryPath(argv[0]);
+    Assert(ChangeDirectory(dir));
+
+    // LoadFontFromNuklear()
+    {
+        Font font = LoadFontFromNuklear(0);
+        Assert(IsFontValid(font));
+        AssertEqual(font.baseSize, RAYLIB_NUKLEAR_DEFAULT_FONTSIZE);
+        AssertEqual(font.glyphCount, RAYLIB_NUKLEAR_DEFAULT_FONT_GLYPHS);
+
+        // Loading the size again comes from its bake, with the same glyphs and its own texture.
+        Font again = LoadFontFromNuklear(RAYLIB_NUKLEAR_DEFAULT_FONTSIZE);
+        Assert(IsFontValid(again));
+        AssertFontsEqual(font, again);
+        AssertNotEqual(font.texture.id, again.texture.id);
+        Assert(font.glyphs != again.glyphs);
+
+        // The font works with a Nuklear context.
+        struct nk_context* ctx = InitNuklearEx(again, 0.0f);
+        Assert(ctx);
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "Default Font", nk_rect(0, 0, 200, 200), NK_WINDOW_BORDER)) {
+            nk_layout_row_dynamic(ctx, 20, 1);
+            nk_label(ctx, "Proggy Clean", NK_TEXT_LEFT);
+        }
+        nk_end(ctx);
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            DrawNuklear(ctx);
+        EndDrawing();
+        UnloadNuklear(ctx);
+
+        UnloadFont(font);
+        UnloadFont(again);
+    }
+
+    // LoadFontFromNuklear() keeps the last RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES sizes baked
+    {
+        UnloadNuklearDefaultFontCache();
+        Font first = LoadFontFromNuklear(20);
+        Assert(IsFontValid(first));
+        for (int i = 1; i <= RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES; i++) {
+            Font font = LoadFontFromNuklear(20 + i * 2);
+            AssertEqual(font.baseSize, 20 + i * 2);
+            UnloadFont(font);
+        }
+
+        // The first size was evicted by the last one, which took its place.
+        for (int i = 0; i < RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES; i++) {
+            AssertNotEqual(raylib_nuklear_default_font_bakes[i].size, 20, "Entry %i", i);
+        }
+        AssertEqual(raylib_nuklear_default_font_bakes[0].size, 20 + RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES * 2);
+
+        // Baking it again gives the same font.
+        Font again = LoadFontFromNuklear(20);
+        AssertFontsEqual(first, again);
+        AssertEqual(raylib_nuklear_default_font_bakes[1].size, 20);
+        UnloadFont(first);
+        UnloadFont(again);
+    }
+
+    // UnloadNuklearDefaultFontCache()
+    {
+        UnloadNuklearDefaultFontCache();
+        for (int i = 0; i < RAYLIB_NUKLEAR_DEFAULT_FONT_CACHE_SIZES; i++) {
+            AssertEqual(raylib_nuklear_default_font_bakes[i].size, 0, "Entry %i", i);
+        }
+        AssertEqual(raylib_nuklear_default_font_ttf, NULL);
+        UnloadNuklearDefaultFontCache();
+
+        // The font can still be loaded afterwards.
+        Font font = LoadFontFromNuklear(0);
+        Assert(IsFontValid(font));
+        Assert(raylib_nuklear_default_font_ttf != NULL);
+        UnloadFont(font);
+    }
+
+    // ExportFontFromNuklearAsCode()
+    {
+        const char* fileName = "raylib-nuklear-default-font-test-font.h";
+        Assert(ExportFontFromNuklearAsCode(fileName));
+        Assert(FileExists(fileName));
+        AssertEqual(remove(fileName), 0);
+    }
+
+    UnloadNuklearDefaultFontCache();
+    CloseWindow();
+    TraceLog(LOG_INFO, "================================");
+    TraceLog(LOG_INFO, "raylib-nuklear-default-font tests succesful");
+    TraceLog(LOG_INFO, "================================");
+
+    return 0;
+}
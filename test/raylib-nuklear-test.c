@@ -1,3 +1,5 @@
+#include <stdio.h>
+
 #include "raylib.h"
 
 #define RAYLIB_NUKLEAR_IMPLEMENTATION
@@ -5,6 +7,30 @@
 
 #include "raylib-assert.h"
 
+// A NuklearAllocator that gives each block at least 64 KB, so that buffers can grow in place.
+typedef struct TestAllocator {
+    int allocations;
+    int frees;
+} TestAllocator;
+
+static void* TestAllocatorAlloc(void* userData, nk_size size) {
+    ((TestAllocator*)userData)->allocations++;
+    nk_size capacity = (size > 64 * 1024) ? size : 64 * 1024;
+    nk_size* block = (nk_size*)MemAlloc((unsigned int)(capacity + 16));
+    block[0] = capacity;
+    return (unsigned char*)block + 16;
+}
+
+static bool TestAllocatorResize(void* userData, void* ptr, nk_size size) {
+    (void)userData;
+    return size <= *(nk_size*)((unsigned char*)ptr - 16);
+}
+
+static void TestAllocatorFree(void* userData, void* ptr) {
+    ((TestAllocator*)userData)->frees++;
+    MemFree((unsigned char*)ptr - 16);
+}
+
 int main(int argc, char *argv[]) {
     // Initialization
     SetTraceLogLevel(LOG_ALL);
@@ -86,6 +112,461 @@ int main(int argc, char *argv[]) {
         UnloadFont(font);
     }
 
+    // nk_raylib_font_get_text_width(), nk_raylib_font_get_text_width_user_font()
+    {
+        // Widths match MeasureTextEx(), with one more spacing, and only measure the given length.
+        const char* texts[] = {"Hello World", "caf\xc3\xa9 \xe4\xb8\xad\xe6\x96\x87", "Two\nLines!", "?"};
+        for (int i = 0; i < 4; i++) {
+            Font defaultFont = GetFontDefault();
+            float expected = MeasureTextEx(defaultFont, texts[i], 20.0f, 2.0f).x + 2.0f;
+            AssertFloatEqual(nk_raylib_font_get_text_width(nk_handle_ptr(0), 20.0f, texts[i], (int)TextLength(texts[i])), expected);
+        }
+        AssertFloatEqual(nk_raylib_font_get_text_width(nk_handle_ptr(0), 20.0f, "Hello World", 5),
+            MeasureTextEx(GetFontDefault(), "Hello", 20.0f, 2.0f).x + 2.0f);
+
+        int codepoints[] = {'a', 'b', 'c', '?', ' ', 0xe9, 0x4e2d, 0x6587};
+        Font font = LoadFontEx("resources/anonymous_pro_bold.ttf", 20, codepoints, 8);
+        ctx = InitNuklearEx(font, 20.0f);
+        Assert(ctx);
+        nk_handle handle = ctx->style.font->userdata;
+        const char* wide[] = {"abc", "\xc3\xa9\xe4\xb8\xad\xe6\x96\x87", "a\nbc", "xyz \xf0\x9f\x98\x80"};
+        for (int i = 0; i < 4; i++) {
+            float expected = MeasureTextEx(font, wide[i], 20.0f, 20.0f * RAYLIB_NUKLEAR_FONT_SPACING_RATIO).x + 20.0f * RAYLIB_NUKLEAR_FONT_SPACING_RATIO;
+            AssertFloatEqual(nk_raylib_font_get_text_width_user_font(handle, 20.0f, wide[i], (int)TextLength(wide[i])), expected);
+        }
+
+        // Long text isn't truncated.
+        char longText[4097];
+        for (int i = 0; i < 4096; i++) {
+            longText[i] = "abc "[i % 4];
+        }
+        longText[4096] = '\0';
+        float halfWidth = nk_raylib_font_get_text_width_user_font(handle, 20.0f, longText, 2048);
+        AssertFloatEqual(nk_raylib_font_get_text_width_user_font(handle, 20.0f, longText, 4096), halfWidth * 2.0f);
+
+        UnloadNuklear(ctx);
+        UnloadFont(font);
+    }
+
+    // LoadNuklearFont(), UnloadNuklearFont()
+    {
+        Font font = LoadFont("resources/anonymous_pro_bold.ttf");
+        struct nk_user_font* userFont = LoadNuklearFont(font, 0.0f);
+        Assert(userFont);
+        AssertEqual(userFont->height, (float)RAYLIB_NUKLEAR_DEFAULT_FONTSIZE);
+        float spacing = userFont->height * RAYLIB_NUKLEAR_FONT_SPACING_RATIO;
+        AssertFloatEqual(userFont->width(userFont->userdata, userFont->height, "Width", 5), MeasureTextEx(font, "Width", userFont->height, spacing).x + spacing);
+#ifdef NK_INCLUDE_VERTEX_BUFFER_OUTPUT
+        // Glyph queries come from the font's recs, in UVs of its texture.
+        AssertEqual(userFont->texture.id, (int)font.texture.id);
+        struct nk_user_font_glyph glyph;
+        userFont->query(userFont->userdata, userFont->height, &glyph, 'W', 0);
+        Rectangle rec = GetGlyphAtlasRec(font, 'W');
+        AssertFloatEqual(glyph.uv[0].x, (rec.x - (float)font.glyphPadding) / (float)font.texture.width);
+        AssertFloatEqual(glyph.uv[1].y, (rec.y + rec.height + (float)font.glyphPadding) / (float)font.texture.height);
+        Assert(glyph.xadvance > 0.0f);
+#endif
+
+        // The font can be pushed onto a context.
+        ctx = InitNuklear(10);
+        Assert(ctx);
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "Fonts", nk_rect(0, 0, 200, 200), NK_WINDOW_BORDER)) {
+            nk_layout_row_dynamic(ctx, 30, 1);
+            nk_style_push_font(ctx, userFont);
+            nk_label(ctx, "Pushed font", NK_TEXT_LEFT);
+            nk_style_pop_font(ctx);
+        }
+        nk_end(ctx);
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            DrawNuklear(ctx);
+        EndDrawing();
+        UnloadNuklear(ctx);
+
+        UnloadNuklearFont(userFont);
+        UnloadNuklearFont(NULL);
+        UnloadFont(font);
+    }
+
+    // LoadNuklearDynamicFont(), LoadNuklearDynamicFontFromMemory()
+    {
+        AssertEqual(LoadNuklearDynamicFont("resources/missing.ttf", 20.0f), NULL);
+        struct nk_user_font* userFont = LoadNuklearDynamicFont("resources/anonymous_pro_bold.ttf", 20.0f);
+        Assert(userFont);
+        AssertEqual(userFont->height, 20.0f);
+        Font* font = (Font*)userFont->userdata.ptr;
+        AssertEqual(font->glyphCount, 95);
+
+        // Glyphs that aren't loaded yet are rasterized as they're measured.
+        const char* cjk = "\xe4\xbd\xa0\xe5\xa5\xbd, \xe4\xb8\x96\xe7\x95\x8c";
+        float spacing = userFont->height * RAYLIB_NUKLEAR_FONT_SPACING_RATIO;
+        float width = userFont->width(userFont->userdata, userFont->height, cjk, (int)TextLength(cjk));
+        AssertEqual(font->glyphCount, 99);
+        AssertEqual(GetGlyphInfo(*font, 0x4e16).value, 0x4e16);
+        AssertFloatEqual(width, MeasureTextEx(*font, cjk, userFont->height, spacing).x + spacing);
+        AssertFloatEqual(userFont->width(userFont->userdata, userFont->height, "Width", 5), MeasureTextEx(*font, "Width", userFont->height, spacing).x + spacing);
+        AssertEqual(font->glyphCount, 99);
+
+        // Drawing the text loads and uploads its glyphs.
+        ctx = InitNuklearContext(userFont);
+        Assert(ctx);
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "Dynamic Font", nk_rect(0, 0, 200, 200), NK_WINDOW_BORDER)) {
+            nk_layout_row_dynamic(ctx, 30, 1);
+            nk_label(ctx, "\xc3\xa9\xe3\x81\x82", NK_TEXT_LEFT);
+        }
+        nk_end(ctx);
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            DrawNuklear(ctx);
+        EndDrawing();
+        AssertEqual(GetGlyphInfo(*font, 0xe9).value, 0xe9);
+        AssertEqual(GetGlyphInfo(*font, 0x3042).value, 0x3042);
+        Assert(GetGlyphAtlasRec(*font, 0x3042).width > 0.0f);
+        UnloadNuklear(ctx);
+
+        // Fonts can be loaded from memory.
+        int dataSize = 0;
+        unsigned char* fileData = LoadFileData("resources/anonymous_pro_bold.ttf", &dataSize);
+        userFont = LoadNuklearDynamicFontFromMemory(fileData, dataSize, 0.0f);
+        UnloadFileData(fileData);
+        Assert(userFont);
+        AssertEqual(userFont->height, (float)RAYLIB_NUKLEAR_DEFAULT_FONTSIZE);
+        AssertEqual(LoadNuklearDynamicFontFromMemory(NULL, 0, 0.0f), NULL);
+        UnloadNuklearFont(userFont);
+    }
+
+    // LoadNuklearDynamicFont() with glyphs that don't fit into its atlas
+    {
+        // Glyphs taller than a page are left out of the atlas, and aren't rasterized again.
+        struct nk_user_font* userFont = LoadNuklearDynamicFont("resources/anonymous_pro_bold.ttf", 400.0f);
+        Assert(userFont);
+        NuklearFont* font = (NuklearFont*)userFont->userdata.ptr;
+        int index = raylib_nuklear_glyph_index(&font->font, &font->advances, 'W');
+        AssertEqual(font->dynamic->glyphPages[index], -2);
+        UnloadNuklearFont(userFont);
+
+        // More glyphs than the atlas holds are measured in one frame, filling every page.
+        userFont = LoadNuklearDynamicFont("resources/anonymous_pro_bold.ttf", 100.0f);
+        Assert(userFont);
+        font = (NuklearFont*)userFont->userdata.ptr;
+        NuklearDynamicFont* dynamic = font->dynamic;
+        char text[400 * 3];
+        for (int i = 0; i < 400; i++) {
+            int codepoint = 0x4e00 + i;
+            text[i * 3] = (char)(0xe0 | (codepoint >> 12));
+            text[i * 3 + 1] = (char)(0x80 | ((codepoint >> 6) & 0x3f));
+            text[i * 3 + 2] = (char)(0x80 | (codepoint & 0x3f));
+        }
+        userFont->width(userFont->userdata, userFont->height, text, (int)sizeof(text));
+        AssertEqual(dynamic->fullFrame, raylib_nuklear_dynamic_font_frame);
+        int last = raylib_nuklear_glyph_index(&font->font, &font->advances, 0x4e00 + 399);
+        AssertEqual(font->font.glyphs[last].value, 0x4e00 + 399);
+        AssertEqual(dynamic->glyphPages[last], -1, "The last glyph doesn't fit");
+
+        // In the next frame, the glyph evicts the least recently used page.
+        int evicted = raylib_nuklear_glyph_index(&font->font, &font->advances, '!');
+        AssertEqual(dynamic->glyphPages[evicted], 0);
+        raylib_nuklear_update_dynamic_fonts();
+        userFont->width(userFont->userdata, userFont->height, &text[399 * 3], 3);
+        AssertEqual(dynamic->glyphPages[last], 0, "The glyph takes the first page");
+        AssertEqual(dynamic->glyphPages[evicted], -1, "The page's glyphs are evicted");
+        AssertNotEqual(dynamic->fullFrame, raylib_nuklear_dynamic_font_frame);
+        UnloadNuklearFont(userFont);
+    }
+
+    // LoadNuklearSDFFont(), InitNuklearSDF()
+    {
+        AssertEqual(LoadNuklearSDFFont("resources/missing.ttf", 20.0f), NULL);
+        AssertEqual(InitNuklearSDF("resources/missing.ttf", 20.0f), NULL);
+        struct nk_user_font* userFont = LoadNuklearSDFFont("resources/anonymous_pro_bold.ttf", 20.0f);
+        Assert(userFont);
+        AssertEqual(userFont->height, 20.0f);
+        Font* font = (Font*)userFont->userdata.ptr;
+        AssertEqual(font->baseSize, RAYLIB_NUKLEAR_SDF_FONT_SIZE);
+        AssertEqual(font->glyphCount, 95);
+        float spacing = userFont->height * RAYLIB_NUKLEAR_FONT_SPACING_RATIO;
+        AssertFloatEqual(userFont->width(userFont->userdata, userFont->height, "Width", 5), MeasureTextEx(*font, "Width", userFont->height, spacing).x + spacing);
+
+        // The context owns its SDF font, and draws it at any scaling from the same atlas.
+        ctx = InitNuklearSDF("resources/anonymous_pro_bold.ttf", 0.0f);
+        Assert(ctx);
+        AssertEqual(ctx->style.font->height, (float)RAYLIB_NUKLEAR_DEFAULT_FONTSIZE);
+        unsigned int texture = ((Font*)ctx->style.font->userdata.ptr)->texture.id;
+        for (int i = 1; i <= 3; i++) {
+            SetNuklearScaling(ctx, (float)i * 1.5f);
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "SDF Font", nk_rect(0, 0, 200, 200), NK_WINDOW_BORDER)) {
+                nk_layout_row_dynamic(ctx, 30, 1);
+                nk_label(ctx, "Context font", NK_TEXT_LEFT);
+                nk_style_push_font(ctx, userFont);
+                nk_label(ctx, "Pushed font", NK_TEXT_LEFT);
+                nk_style_pop_font(ctx);
+                nk_button_label(ctx, "Button");
+            }
+            nk_end(ctx);
+            BeginDrawing();
+                ClearBackground(RAYWHITE);
+                DrawNuklear(ctx);
+            EndDrawing();
+            AssertEqual(((Font*)ctx->style.font->userdata.ptr)->texture.id, texture);
+        }
+        UnloadNuklear(ctx);
+        UnloadNuklearFont(userFont);
+    }
+
+    // LoadFontFromNuklearCache()
+    {
+        // Start from a corrupt cache file, which is baked over.
+        const char* cacheFile = "raylib-nuklear-test-fonts.cache";
+        char garbage[] = "not a font cache";
+        Assert(SaveFileData(cacheFile, garbage, (int)sizeof(garbage)));
+        Font font = LoadFontFromNuklearCache(cacheFile, "resources/anonymous_pro_bold.ttf", 20, NULL, 0);
+        AssertEqual(font.glyphCount, 95);
+        AssertEqual(font.baseSize, 20);
+        int cacheSize = 0;
+        unsigned char* cache = LoadFileData(cacheFile, &cacheSize);
+        Assert(cacheSize > (int)sizeof(garbage));
+
+        // The second load comes from the cache, with the same glyphs.
+        Font cached = LoadFontFromNuklearCache(cacheFile, "resources/anonymous_pro_bold.ttf", 20, NULL, 0);
+        AssertEqual(cached.glyphCount, font.glyphCount);
+        AssertEqual(cached.glyphs[33].value, font.glyphs[33].value);
+        AssertEqual(cached.glyphs[33].advanceX, font.glyphs[33].advanceX);
+        AssertFloatEqual(cached.recs[33].x, font.recs[33].x);
+        AssertFloatEqual(cached.recs[33].height, font.recs[33].height);
+        int size = 0;
+        unsigned char* unchanged = LoadFileData(cacheFile, &size);
+        AssertEqual(size, cacheSize);
+        UnloadFileData(unchanged);
+        UnloadFont(cached);
+
+        // Other sizes and glyph sets are added to the same file.
+        cached = LoadFontFromNuklearCache(cacheFile, "resources/anonymous_pro_bold.ttf", 24, NULL, 0);
+        AssertEqual(cached.baseSize, 24);
+        AssertEqual(cached.glyphCount, 95);
+        UnloadFont(cached);
+        unchanged = LoadFileData(cacheFile, &size);
+        Assert(size > cacheSize);
+        UnloadFileData(unchanged);
+        int sizesSize = size;
+        int codepoints[3] = {'a', 'b', 0x4e16};
+        cached = LoadFontFromNuklearCache(cacheFile, "resources/anonymous_pro_bold.ttf", 20, codepoints, 3);
+        AssertEqual(cached.glyphCount, 3);
+        AssertEqual(cached.glyphs[2].value, 0x4e16);
+        UnloadFont(cached);
+        unchanged = LoadFileData(cacheFile, &size);
+        Assert(size > sizesSize);
+        UnloadFileData(unchanged);
+
+        // A corrupt entry is baked again, and the file is repaired.
+        cache[cacheSize - 1] ^= 0xff;
+        Assert(SaveFileData(cacheFile, cache, cacheSize));
+        cached = LoadFontFromNuklearCache(cacheFile, "resources/anonymous_pro_bold.ttf", 20, NULL, 0);
+        AssertEqual(cached.glyphCount, 95);
+        UnloadFont(cached);
+        unsigned char* repaired = LoadFileData(cacheFile, &size);
+        AssertEqual(size, cacheSize);
+        AssertEqual(repaired[cacheSize - 1], (unsigned char)(cache[cacheSize - 1] ^ 0xff));
+        UnloadFileData(repaired);
+        UnloadFileData(cache);
+
+        AssertEqual(LoadFontFromNuklearCache(cacheFile, "resources/missing.ttf", 20, NULL, 0).glyphCount, 0);
+        UnloadFont(font);
+        AssertEqual(remove(cacheFile), 0);
+    }
+
+    // GetNuklearFont()
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+        AssertEqual(GetNuklearFont(NULL, "resources/anonymous_pro_bold.ttf", 20.0f), NULL);
+        AssertEqual(GetNuklearFont(ctx, "resources/missing.ttf", 20.0f), NULL);
+        struct nk_user_font* userFont = GetNuklearFont(ctx, "resources/anonymous_pro_bold.ttf", 20.0f);
+        Assert(userFont);
+        AssertEqual(userFont->height, 20.0f);
+        AssertEqual(((Font*)userFont->userdata.ptr)->baseSize, 20);
+
+        // Registered fonts are looked up rather than loaded again.
+        AssertEqual(GetNuklearFont(ctx, "resources/anonymous_pro_bold.ttf", 20.0f), userFont);
+        struct nk_user_font* smallFont = GetNuklearFont(ctx, "resources/anonymous_pro_bold.ttf", 0.0f);
+        Assert(smallFont);
+        Assert(smallFont != userFont);
+        AssertEqual(smallFont->height, (float)RAYLIB_NUKLEAR_DEFAULT_FONTSIZE);
+
+        // Scaling bakes the fonts at their scaled size, keeping their logical size.
+        SetNuklearScaling(ctx, 2.0f);
+        AssertEqual(((Font*)userFont->userdata.ptr)->baseSize, 40);
+        AssertEqual(((Font*)smallFont->userdata.ptr)->baseSize, RAYLIB_NUKLEAR_DEFAULT_FONTSIZE * 2);
+        AssertEqual(userFont->height, 20.0f);
+        float spacing = userFont->height * RAYLIB_NUKLEAR_FONT_SPACING_RATIO;
+        AssertFloatEqual(userFont->width(userFont->userdata, userFont->height, "Width", 5), MeasureTextEx(*(Font*)userFont->userdata.ptr, "Width", userFont->height, spacing).x + spacing);
+        AssertEqual(GetNuklearFont(ctx, "resources/anonymous_pro_bold.ttf", 20.0f), userFont);
+
+        // The context owns its registered fonts, even when one is its style's font.
+        UnloadNuklearFont((struct nk_user_font*)ctx->style.font);
+        nk_style_set_font(ctx, userFont);
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "Registered Fonts", nk_rect(0, 0, 200, 200), NK_WINDOW_BORDER)) {
+            nk_layout_row_dynamic(ctx, 30, 1);
+            nk_style_push_font(ctx, smallFont);
+            nk_label(ctx, "Small", NK_TEXT_LEFT);
+            nk_style_pop_font(ctx);
+            nk_label(ctx, "Large", NK_TEXT_LEFT);
+        }
+        nk_end(ctx);
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            DrawNuklear(ctx);
+        EndDrawing();
+        UnloadNuklear(ctx);
+    }
+
+    // ShareNuklearFont(), and contexts sharing a font
+    {
+        Font font = LoadFontEx("resources/anonymous_pro_bold.ttf", 20, NULL, 0);
+        Assert(IsFontValid(font));
+
+        // Contexts that are initialized with the same font share its glyph tables.
+        struct nk_context* ui = InitNuklearEx(font, 20.0f);
+        struct nk_context* overlay = InitNuklearEx(font, 12.0f);
+        Assert(ui);
+        Assert(overlay);
+        NuklearFont* shared = (NuklearFont*)ui->style.font->userdata.ptr;
+        AssertEqual(overlay->style.font->userdata.ptr, (void*)shared);
+        AssertEqual(shared->references, 2);
+        AssertEqual(overlay->style.font->height, 12.0f);
+
+        // Shared fonts measure at their own size, and outlive the context they came from.
+        struct nk_user_font* small = ShareNuklearFont(ui->style.font, 10.0f);
+        Assert(small);
+        AssertEqual(small->userdata.ptr, (void*)shared);
+        AssertEqual(small->height, 10.0f);
+        AssertEqual(shared->references, 3);
+        UnloadNuklear(ui);
+        AssertEqual(shared->references, 2);
+        AssertFloatEqual(small->width(small->userdata, small->height, "Shared", 6) * 2.0f, small->width(small->userdata, 20.0f, "Shared", 6));
+        UnloadNuklearFont(small);
+        UnloadNuklear(overlay);
+
+        // A registered font stays loaded while another context uses it.
+        struct nk_context* owner = InitNuklear(10);
+        struct nk_user_font* registered = GetNuklearFont(owner, "resources/anonymous_pro_bold.ttf", 16.0f);
+        Assert(registered);
+        struct nk_context* other = InitNuklearContext(ShareNuklearFont(registered, 0.0f));
+        Assert(other);
+        AssertEqual(other->style.font->height, 16.0f);
+        UnloadNuklear(owner);
+        Assert(((Font*)other->style.font->userdata.ptr)->texture.id != 0);
+        UpdateNuklear(other);
+        if (nk_begin(other, "Shared", nk_rect(0, 0, 100, 100), 0)) {
+            nk_layout_row_dynamic(other, 20, 1);
+            nk_label(other, "Shared", NK_TEXT_LEFT);
+        }
+        nk_end(other);
+        BeginDrawing();
+            DrawNuklear(other);
+        EndDrawing();
+        UnloadNuklear(other);
+
+        AssertEqual(ShareNuklearFont(NULL, 0.0f), NULL);
+        UnloadFont(font);
+    }
+
+    // nk_raylib_label_wrap(), nk_raylib_text_wrap()
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+        NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+        char text[] = "The quick brown fox jumps over the lazy dog, again and again, until the line breaks a few times.";
+
+        // The cached layout matches nk_label_wrap(), line for line.
+        char expected[16][64];
+        struct nk_rect expectedRects[16];
+        int expectedCount = 0;
+        for (int frame = 0; frame < 3; frame++) {
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "Wrap", nk_rect(0, 0, 150, 300), NK_WINDOW_NO_SCROLLBAR)) {
+                nk_layout_row_dynamic(ctx, 200, 1);
+                if (frame == 0) {
+                    nk_label_wrap(ctx, text);
+                } else {
+                    nk_raylib_label_wrap(ctx, text);
+                }
+            }
+            nk_end(ctx);
+
+            int count = 0;
+            const struct nk_command* cmd;
+            nk_foreach(cmd, ctx) {
+                if (cmd->type != NK_COMMAND_TEXT) continue;
+                const struct nk_command_text* t = (const struct nk_command_text*)cmd;
+                Assert(count < 16);
+                if (frame == 0) {
+                    TextCopy(expected[count], t->string);
+                    expectedRects[count] = nk_rect(t->x, t->y, t->w, t->h);
+                } else {
+                    Assert(TextIsEqual(expected[count], t->string), "Line %i: %s", count, t->string);
+                    AssertEqual(expectedRects[count].y, (float)t->y);
+                    AssertEqual(expectedRects[count].w, (float)t->w);
+                }
+                count++;
+            }
+            if (frame == 0) {
+                expectedCount = count;
+                Assert(expectedCount > 2, "Wrapped into %i lines", expectedCount);
+            } else {
+                AssertEqual(count, expectedCount);
+            }
+            nk_clear(ctx);
+        }
+        AssertEqual(userData->wrap_text_count, 1, "Unchanged text is laid out from the cache");
+        AssertEqual(userData->wrap_texts[0].lineCount, expectedCount);
+
+        // Changing the text in place lays it out again, and the old layout ages out once it's unused.
+        text[4] = 'Q';
+        for (int frame = 0; frame < 3; frame++) {
+            if (nk_begin(ctx, "Wrap", nk_rect(0, 0, 150, 300), NK_WINDOW_NO_SCROLLBAR)) {
+                nk_layout_row_dynamic(ctx, 200, 1);
+                nk_raylib_text_wrap(ctx, text, (int)TextLength(text));
+            }
+            nk_end(ctx);
+            AssertEqual(userData->wrap_text_count, frame == 0 ? 2 : 1, "Frame %i", frame);
+            nk_clear(ctx);
+        }
+
+        // Many texts are looked up through a hash table, which is filled again when texts age out. The changed text
+        // from above ages out after the first frame.
+        const int wrapCounts[] = {201, 200, 200, 100};
+        for (int frame = 0; frame < 4; frame++) {
+            if (nk_begin(ctx, "Wrap", nk_rect(0, 0, 150, 5000), NK_WINDOW_NO_SCROLLBAR)) {
+                nk_layout_row_dynamic(ctx, 20, 1);
+                for (int i = 0; i < ((frame < 2) ? 200 : 100); i++) {
+                    const char* line = TextFormat("Wrapped line %i", i);
+                    nk_raylib_text_wrap(ctx, line, (int)TextLength(line));
+                }
+            }
+            nk_end(ctx);
+            AssertEqual(userData->wrap_text_count, wrapCounts[frame], "Frame %i", frame);
+            Assert(userData->wrap_slot_count >= userData->wrap_text_count * 2, "Frame %i slots", frame);
+            nk_clear(ctx);
+        }
+
+        // Text that doesn't fit its row is cut off like nk_label_wrap().
+        if (nk_begin(ctx, "Wrap", nk_rect(0, 0, 150, 300), NK_WINDOW_NO_SCROLLBAR)) {
+            nk_layout_row_dynamic(ctx, 20, 1);
+            nk_raylib_label_colored_wrap(ctx, text, nk_rgb(255, 0, 0));
+            nk_raylib_text_wrap(ctx, NULL, 0);
+        }
+        nk_end(ctx);
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            DrawNuklear(ctx);
+        EndDrawing();
+        UnloadNuklear(ctx);
+    }
+
     // NuklearRectToRectangle()
     {
         ctx = NULL;
@@ -236,6 +717,305 @@ int main(int argc, char *argv[]) {
             };
             nk_fill_polygon(canvas, touching, 6, color);
             nk_stroke_polygon(canvas, touching, 6, 1.0f, color);
+
+            // A self-intersecting pentagram, filled by the even-odd rule.
+            float pentagram[] = {
+                50.0f, 5.0f,
+                76.0f, 86.0f,
+                7.0f, 36.0f,
+                93.0f, 36.0f,
+                24.0f, 86.0f
+            };
+            nk_fill_polygon(canvas, pentagram, 5, color);
+        }
+        nk_end(ctx);
+
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            DrawNuklear(ctx);
+        EndDrawing();
+
+        UnloadNuklear(ctx);
+    }
+
+    // DrawNuklearBatched() falls back to DrawNuklear() without RAYLIB_NUKLEAR_USE_VERTEX_BUFFER.
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "Batched", nk_rect(0, 0, 100, 100), NK_WINDOW_TITLE)) {
+            nk_layout_row_dynamic(ctx, 20, 1);
+            nk_button_label(ctx, "Button");
+        }
+        nk_end(ctx);
+
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            DrawNuklearBatched(ctx);
+        EndDrawing();
+
+        UnloadNuklear(ctx);
+    }
+
+    // raylib_nuklear_triangulate_polygon() and raylib_nuklear_fill_polygon_even_odd() must cover exactly what the
+    // even-odd scanline fill covered.
+    {
+        // A concave star, wound clockwise, and an L-shape wound counter-clockwise.
+        Vector2 star[10];
+        for (int i = 0; i < 10; i++) {
+            float radius = (i % 2 == 0) ? 40.0f : 15.0f;
+            float angle = (float)i * PI / 5.0f;
+            star[i] = (Vector2){50.0f + cosf(angle) * radius, 50.0f + sinf(angle) * radius};
+        }
+        Vector2 shape[] = {{10, 10}, {10, 90}, {90, 90}, {90, 70}, {30, 70}, {30, 10}};
+
+        // Self-intersecting polygons: a {5/2} pentagram, which turns the same way at every point but leaves its centre
+        // empty, and a bow tie.
+        Vector2 pentagram[5];
+        for (int i = 0; i < 5; i++) {
+            float angle = (float)i * 4.0f * PI / 5.0f - PI / 2.0f;
+            pentagram[i] = (Vector2){50.0f + cosf(angle) * 45.0f, 50.0f + sinf(angle) * 45.0f};
+        }
+        Vector2 bowTie[] = {{10, 10}, {90, 90}, {90, 10}, {10, 90}};
+        const Vector2* polygons[] = {star, shape, pentagram, bowTie};
+        int counts[] = {10, 6, 5, 4};
+
+        for (int p = 0; p < 4; p++) {
+            const Vector2* points = polygons[p];
+            int count = counts[p];
+            int remaining[10];
+            int triangles[24];
+            Vector2 vertices[120];
+            int vertexCount = 0;
+            int triangleCount = raylib_nuklear_triangulate_polygon(points, count, remaining, triangles);
+            if (p < 2) {
+                AssertEqual(triangleCount, count - 2);
+                for (int i = 0; i < triangleCount * 3; i++) {
+                    vertices[vertexCount++] = points[triangles[i]];
+                }
+            }
+            else {
+                // Overlapping triangles can't leave holes, so these are filled by raylib_nuklear_fill_polygon_even_odd().
+                AssertEqual(triangleCount, -1, "Polygon %i isn't triangulated", p);
+                float ys[20];
+                int edges[10];
+                float xs[10];
+                AssertEqual(raylib_nuklear_polygon_crossings(points, count, NULL), p == 2 ? 5 : 1);
+                vertexCount = raylib_nuklear_fill_polygon_even_odd(points, count, ys, edges, xs, NULL);
+                Assert(vertexCount > 0 && vertexCount <= 120);
+                AssertEqual(raylib_nuklear_fill_polygon_even_odd(points, count, ys, edges, xs, vertices), vertexCount);
+            }
+
+            // Every triangle is wound the way DrawTriangle() expects.
+            for (int t = 0; t < vertexCount; t += 3) {
+                Assert(raylib_nuklear_triangle_area(vertices[t], vertices[t + 1], vertices[t + 2]) < 0.0f);
+            }
+
+            // Sample points are inside exactly one triangle when the even-odd rule says they're inside the polygon.
+            for (float y = 0.37f; y < 100.0f; y += 3.1f) {
+                for (float x = 0.41f; x < 100.0f; x += 3.1f) {
+                    bool inside = false;
+                    for (int i = 0, j = count - 1; i < count; j = i++) {
+                        if (((points[i].y > y) != (points[j].y > y)) &&
+                                (x < (points[j].x - points[i].x) * (y - points[i].y) / (points[j].y - points[i].y) + points[i].x)) {
+                            inside = !inside;
+                        }
+                    }
+
+                    int covered = 0;
+                    for (int t = 0; t < vertexCount; t += 3) {
+                        Vector2 a = vertices[t], b = vertices[t + 1], c = vertices[t + 2];
+                        Vector2 sample = {x, y};
+                        if (raylib_nuklear_triangle_area(a, b, sample) < 0.0f &&
+                                raylib_nuklear_triangle_area(b, c, sample) < 0.0f &&
+                                raylib_nuklear_triangle_area(c, a, sample) < 0.0f) {
+                            covered++;
+                        }
+                    }
+                    AssertEqual(covered, inside ? 1 : 0, "Polygon %i coverage mismatch at %f, %f", p, x, y);
+                }
+            }
+        }
+    }
+
+    // NK_COMMAND_POLYGON_FILLED has no point limit.
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "PolygonFill", nk_rect(0, 0, 200, 200), NK_WINDOW_NO_SCROLLBAR)) {
+            float circle[200 * 2];
+            for (int i = 0; i < 200; i++) {
+                circle[i * 2] = 100.0f + cosf((float)i * 2.0f * PI / 200.0f) * 80.0f;
+                circle[i * 2 + 1] = 100.0f + sinf((float)i * 2.0f * PI / 200.0f) * 80.0f;
+            }
+            nk_fill_polygon(nk_window_get_canvas(ctx), circle, 200, nk_rgb(20, 230, 20));
+        }
+        nk_end(ctx);
+
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            DrawNuklear(ctx);
+        EndDrawing();
+
+        UnloadNuklear(ctx);
+    }
+
+    // SetNuklearWindowCache(), GetNuklearRenderStats()
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+        SetNuklearWindowCache(ctx, true);
+        NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+
+        const char* labels[] = {"Same", "Same", "Changed"};
+        for (int frame = 0; frame < 3; frame++) {
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "Cached", nk_rect(10, 10, 100, 100), NK_WINDOW_BORDER|NK_WINDOW_NO_SCROLLBAR)) {
+                nk_layout_row_dynamic(ctx, 20, 1);
+                nk_label(ctx, labels[frame], NK_TEXT_LEFT);
+            }
+            nk_end(ctx);
+
+            BeginDrawing();
+                ClearBackground(RAYWHITE);
+                DrawNuklear(ctx);
+            EndDrawing();
+
+            NuklearRenderStats stats = GetNuklearRenderStats(ctx);
+            AssertEqual(stats.cacheHits, (frame == 1) ? 1u : 0u, "Frame %i cache hits", frame);
+            AssertEqual(stats.cacheMisses, (frame == 1) ? 0u : 1u, "Frame %i cache misses", frame);
+            AssertEqual(userData->window_cache_count, 1);
+        }
+
+        // Windows that aren't drawn anymore are evicted.
+        UpdateNuklear(ctx);
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            DrawNuklear(ctx);
+        EndDrawing();
+        AssertEqual(userData->window_cache_count, 0);
+
+        SetNuklearWindowCache(ctx, false);
+        AssertEqual(GetNuklearRenderStats(NULL).cacheHits, 0u);
+        UnloadNuklear(ctx);
+    }
+
+    // Radius-adaptive tessellation
+    {
+        // Small corners use fewer segments than large knobs.
+        Assert(raylib_nuklear_circle_segments(2.0f) < raylib_nuklear_circle_segments(300.0f));
+        AssertEqual(raylib_nuklear_circle_segments(0.0f), 8);
+        AssertEqual(raylib_nuklear_circle_segments(100000.0f), RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX);
+
+        // The segments stay within the tolerance of the true circle.
+        for (float radius = 1.0f; radius < 1000.0f; radius *= 1.5f) {
+            int segments = raylib_nuklear_circle_segments(radius);
+            float error = radius * (1.0f - cosf(PI / (float)segments));
+            Assert(segments == RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX || error <= RAYLIB_NUKLEAR_TESSELLATION_TOLERANCE,
+                "Radius %f with %i segments is off by %f", radius, segments, error);
+        }
+
+        // The unit circle table goes clockwise on the screen.
+        const Vector2* circle = raylib_nuklear_get_unit_circle();
+        AssertFloatEqual(circle[0].x, 1.0f);
+        AssertFloatEqual(circle[RAYLIB_NUKLEAR_CIRCLE_SEGMENTS_MAX / 4].y, 1.0f);
+
+        // Ellipses pick their segments from the perimeter, between those of circles with their smallest and largest radius.
+        AssertEqual(raylib_nuklear_ellipse_segments(50.0f, 50.0f), raylib_nuklear_circle_segments(50.0f));
+        Assert(raylib_nuklear_ellipse_segments(200.0f, 5.0f) >= raylib_nuklear_circle_segments(5.0f));
+        Assert(raylib_nuklear_ellipse_segments(200.0f, 5.0f) <= raylib_nuklear_circle_segments(200.0f));
+        AssertEqual(raylib_nuklear_ellipse_segments(0.0f, 0.0f), 8);
+
+        // Straight curves need a single segment, bent ones need more.
+        AssertEqual(raylib_nuklear_curve_segments((Vector2){0, 0}, (Vector2){10, 0}, (Vector2){20, 0}, (Vector2){30, 0}), 1);
+        Assert(raylib_nuklear_curve_segments((Vector2){0, 0}, (Vector2){0, 200}, (Vector2){200, 200}, (Vector2){200, 0}) > 8);
+
+        // Draw all the tessellated commands.
+        ctx = InitNuklear(10);
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "Shapes", nk_rect(0, 0, 400, 400), NK_WINDOW_BORDER)) {
+            struct nk_command_buffer* canvas = nk_window_get_canvas(ctx);
+            nk_fill_rect(canvas, nk_rect(10, 10, 100, 50), 4, nk_rgb(255, 0, 0));
+            nk_stroke_rect(canvas, nk_rect(10, 70, 100, 50), 20, 2, nk_rgb(0, 255, 0));
+            nk_stroke_circle(canvas, nk_rect(120, 10, 150, 150), 3, nk_rgb(0, 0, 255));
+            nk_fill_arc(canvas, 200, 250, 60, 0.0f, 1.5f * NK_PI, nk_rgb(255, 255, 0));
+            nk_stroke_arc(canvas, 300, 250, 40, 1.0f, 3.0f, 2, nk_rgb(255, 0, 255));
+            nk_stroke_curve(canvas, 10, 300, 50, 200, 150, 400, 190, 300, 3, nk_rgb(0, 255, 255));
+            nk_stroke_circle(canvas, nk_rect(280, 10, 100, 40), 2, nk_rgb(0, 0, 0));
+            nk_stroke_circle(canvas, nk_rect(280, 60, 100, 40), 30, nk_rgb(0, 0, 0)); // Thicker than the ellipse
+            nk_fill_circle(canvas, nk_rect(280, 110, 101, 41), nk_rgb(0, 0, 0));
+        }
+        nk_end(ctx);
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            DrawNuklear(ctx);
+        EndDrawing();
+        UnloadNuklear(ctx);
+    }
+
+    // SetNuklearSDFShapes()
+    {
+        // The shape parameters survive encoding, as the shader decodes them.
+        float radii[] = {0.0f, 2.0f, 12.5f, 150.0f, 2048.0f};
+        float thicknesses[] = {0.0f, 1.0f, 2.5f, 16.0f, 254.0f};
+        for (int r = 0; r < 5; r++) {
+            for (int t = 0; t < 5; t++) {
+                float shape = raylib_nuklear_sdf_encode(radii[r], thicknesses[t]) - 1.0f;
+                AssertFloatEqual(floorf(shape) * 0.25f, radii[r]);
+                Assert(fabsf((shape - floorf(shape)) * 256.0f - 0.5f - thicknesses[t]) < 0.01f, "Thickness %f", thicknesses[t]);
+            }
+        }
+
+        ctx = InitNuklear(10);
+        Assert(ctx);
+
+        // Shaders may be unavailable, like on the software renderer, in which case shapes are tessellated instead.
+        bool sdf = SetNuklearSDFShapes(ctx, true);
+        AssertEqual(SetNuklearSDFShapes(ctx, true), sdf);
+
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "SDF", nk_rect(0, 0, 400, 400), NK_WINDOW_BORDER)) {
+            struct nk_command_buffer* canvas = nk_window_get_canvas(ctx);
+            nk_fill_rect(canvas, nk_rect(10, 10, 100, 50), 8, nk_rgb(255, 0, 0));
+            nk_stroke_rect(canvas, nk_rect(10, 70, 100, 50), 8, 2, nk_rgb(0, 255, 0));
+            nk_fill_circle(canvas, nk_rect(120, 10, 60, 60), nk_rgb(0, 0, 255));
+            nk_stroke_circle(canvas, nk_rect(200, 10, 60, 60), 3, nk_rgb(0, 0, 255));
+            nk_fill_arc(canvas, 200, 250, 60, -0.5f, 2.0f * NK_PI, nk_rgb(255, 255, 0));
+            nk_stroke_arc(canvas, 300, 250, 40, 1.0f, 3.0f, 2, nk_rgb(255, 0, 255));
+            nk_layout_row_dynamic(ctx, 20, 1);
+            nk_button_label(ctx, "Button");
+        }
+        nk_end(ctx);
+        BeginDrawing();
+            ClearBackground(RAYWHITE);
+            DrawNuklear(ctx);
+        EndDrawing();
+
+        AssertNot(SetNuklearSDFShapes(ctx, false));
+        AssertNot(SetNuklearSDFShapes(NULL, true));
+        UnloadNuklear(ctx);
+    }
+
+    // DrawNuklear() skips redundant scissors and culls commands that can't be seen
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "Visible", nk_rect(10, 10, 200, 200), NK_WINDOW_BORDER)) {
+            struct nk_command_buffer* canvas = nk_window_get_canvas(ctx);
+            struct nk_rect clip = nk_rect(20, 40, 100, 100);
+            nk_push_scissor(canvas, clip);
+            nk_push_scissor(canvas, clip);
+            nk_fill_rect(canvas, nk_rect(30, 50, 20, 20), 0, nk_rgb(255, 0, 0));
+        }
+        nk_end(ctx);
+        if (nk_begin(ctx, "Offscreen", nk_rect(2000, 10, 100, 100), NK_WINDOW_BORDER)) {
+            nk_layout_row_dynamic(ctx, 20, 1);
+            nk_label(ctx, "Not on the screen", NK_TEXT_LEFT);
         }
         nk_end(ctx);
 
@@ -244,14 +1024,596 @@ int main(int argc, char *argv[]) {
             DrawNuklear(ctx);
         EndDrawing();
 
+        NuklearRenderStats stats = GetNuklearRenderStats(ctx);
+        Assert(stats.drawCalls > 0, "Draw calls: %u", stats.drawCalls);
+        Assert(stats.skippedScissors >= 1, "Skipped scissors: %u", stats.skippedScissors);
+        Assert(stats.culledCommands >= 2, "Culled commands: %u", stats.culledCommands);
+        Assert(stats.batchFlushes > 0, "Batch flushes: %u", stats.batchFlushes);
+
+        UnloadNuklear(ctx);
+    }
+
+    // DrawNuklear() keeps the glyph layout of text between frames, and culls glyphs outside the clip rectangle
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+        NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+
+        const char* row = "A long row of a log view, most of which is scrolled out of view on the right";
+        for (int frame = 0; frame < 3; frame++) {
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "Runs", nk_rect(0, 0, 400, 200), NK_WINDOW_NO_SCROLLBAR)) {
+                struct nk_command_buffer* canvas = nk_window_get_canvas(ctx);
+                nk_push_scissor(canvas, nk_rect(0, 0, 60, 100));
+                nk_draw_text(canvas, nk_rect(0, 10, 1000, 20), row, (int)TextLength(row), ctx->style.font, nk_rgba(0, 0, 0, 0), nk_rgb(255, 255, 255));
+                if (frame < 2) {
+                    nk_draw_text(canvas, nk_rect(0, 40, 1000, 20), "Gone", 4, ctx->style.font, nk_rgba(0, 0, 0, 0), nk_rgb(255, 255, 255));
+                }
+            }
+            nk_end(ctx);
+
+            BeginDrawing();
+                ClearBackground(RAYWHITE);
+                DrawNuklear(ctx);
+            EndDrawing();
+
+            NuklearRenderStats stats = GetNuklearRenderStats(ctx);
+            Assert(stats.culledGlyphs > 40, "Culled glyphs: %u", stats.culledGlyphs);
+            AssertEqual(userData->text_runs.count, frame < 2 ? 2 : 1, "Frame %i text runs", frame);
+        }
+        AssertEqual(userData->text_runs.runs[0].length, (int)TextLength(row));
+
+        UnloadNuklear(ctx);
+    }
+
+    // SetNuklearAtlas(), AddNuklearAtlasTexture(), RemoveNuklearAtlasTexture()
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+
+        Image iconImage = GenImageColor(16, 16, RED);
+        Texture icon = LoadTextureFromImage(iconImage);
+        UnloadImage(iconImage);
+        AssertNot(AddNuklearAtlasTexture(ctx, icon), "The atlas needs to be enabled first");
+        Assert(SetNuklearAtlas(ctx, true));
+        Assert(AddNuklearAtlasTexture(ctx, icon));
+        Assert(AddNuklearAtlasTexture(ctx, icon), "Adding a texture twice is fine");
+        Texture large = {icon.id + 1000, RAYLIB_NUKLEAR_ATLAS_MAX_IMAGE_SIZE + 1, 16, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+        AssertNot(AddNuklearAtlasTexture(ctx, large));
+
+        // The icon is packed after the frame it was first drawn in, after which text, shapes and the icon share a texture.
+        NuklearAtlas* atlas = ((NuklearUserData*)ctx->userdata.ptr)->atlas;
+        for (int frame = 0; frame < 2; frame++) {
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "Atlas", nk_rect(10, 10, 200, 200), NK_WINDOW_BORDER)) {
+                nk_layout_row_dynamic(ctx, 20, 1);
+                nk_label(ctx, "Label", NK_TEXT_LEFT);
+                nk_image(ctx, TextureToNuklearImage(icon));
+                nk_label(ctx, "Another label", NK_TEXT_LEFT);
+            }
+            nk_end(ctx);
+            BeginDrawing();
+                ClearBackground(RAYWHITE);
+                DrawNuklear(ctx);
+            EndDrawing();
+        }
+        AssertEqual(atlas->images[0].page, 0);
+        Assert(atlas->font.texture.id == atlas->pages[0].texture.id, "The font is in the first page");
+        AssertEqual(GetNuklearRenderStats(ctx).textureSwitches, 0);
+
+        // The shapes texture is restored after drawing.
+        AssertNotEqual(GetShapesTexture().id, atlas->pages[0].texture.id);
+
+        RemoveNuklearAtlasTexture(ctx, icon);
+        AssertEqual(atlas->imageCount, 0);
+        AssertNot(SetNuklearAtlas(ctx, false));
+        UnloadTexture(icon);
+        UnloadNuklear(ctx);
+    }
+
+    // Text runs tell fonts in the texture atlas apart, as they share its pages
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+        NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+        Assert(SetNuklearAtlas(ctx, true));
+
+        // The default font has more glyphs than the other one, so its glyph indices would overrun the other's recs.
+        Font anonymous = LoadFontEx("resources/anonymous_pro_bold.ttf", 20, NULL, 0);
+        struct nk_user_font* fonts[2] = {LoadNuklearFont(GetFontDefault(), 20.0f), LoadNuklearFont(anonymous, 20.0f)};
+        Assert(fonts[0] && fonts[1]);
+        Assert(GetFontDefault().glyphCount > anonymous.glyphCount);
+        UnloadNuklearFont((struct nk_user_font*)ctx->style.font);
+        for (int frame = 0; frame < 2; frame++) {
+            nk_style_set_font(ctx, fonts[frame]);
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "Fonts", nk_rect(0, 0, 200, 100), NK_WINDOW_NO_SCROLLBAR)) {
+                nk_draw_text(nk_window_get_canvas(ctx), nk_rect(0, 10, 200, 20), "OK \xc3\xbf", 5, fonts[frame], nk_rgba(0, 0, 0, 0), nk_rgb(255, 255, 255));
+            }
+            nk_end(ctx);
+
+            BeginDrawing();
+                ClearBackground(RAYWHITE);
+                DrawNuklear(ctx);
+            EndDrawing();
+
+            NuklearAtlas* atlas = userData->atlas;
+            Assert(atlas->source == fonts[frame]->userdata.ptr, "Frame %i packs its font", frame);
+            AssertEqual(userData->text_runs.count, 1, "Frame %i text runs", frame);
+            Assert(userData->text_runs.runs[0].glyphs == atlas->font.glyphs, "Frame %i lays the text out with its font", frame);
+        }
+
+        // The context unloads its style's font, which is the second one.
+        UnloadNuklear(ctx);
+        UnloadNuklearFont(fonts[0]);
+        UnloadFont(anonymous);
+    }
+
+    // DrawNuklearEx(), IsNuklearFrameChanged()
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+
+        const char* labels[] = {"Same", "Same", "Same", "Changed"};
+        for (int frame = 0; frame < 4; frame++) {
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "Frame", nk_rect(10, 10, 100, 100), NK_WINDOW_BORDER|NK_WINDOW_NO_SCROLLBAR)) {
+                nk_layout_row_dynamic(ctx, 20, 1);
+                nk_label(ctx, labels[frame], NK_TEXT_LEFT);
+            }
+            nk_end(ctx);
+
+            // Idle frames skip drawing altogether, and are cleared instead.
+            bool expected = frame == 0 || frame == 3;
+            bool changed = IsNuklearFrameChanged(ctx);
+            AssertEqual(changed, expected, "Frame %i IsNuklearFrameChanged()", frame);
+            if (changed) {
+                BeginDrawing();
+                    ClearBackground(RAYWHITE);
+                    Assert(DrawNuklearEx(ctx, NUKLEAR_DRAW_DEFAULT), "Frame %i DrawNuklearEx()", frame);
+                EndDrawing();
+            }
+            else {
+                nk_clear(ctx);
+            }
+        }
+
+        // Changing the scaling changes the frame.
+        SetNuklearScaling(ctx, 2.0f);
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "Frame", nk_rect(10, 10, 100, 100), NK_WINDOW_BORDER|NK_WINDOW_NO_SCROLLBAR)) {
+            nk_layout_row_dynamic(ctx, 20, 1);
+            nk_label(ctx, "Changed", NK_TEXT_LEFT);
+        }
+        nk_end(ctx);
+        Assert(IsNuklearFrameChanged(ctx));
+
+        // The frame is hashed once, and drawing it remembers it.
+        NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+        userData->frame_seq_hash = ~userData->frame_seq_hash;
+        Assert(DrawNuklearEx(ctx, NUKLEAR_DRAW_DEFAULT));
+        AssertEqual(userData->frame_hash, userData->frame_seq_hash);
+
+        AssertNot(DrawNuklearEx(NULL, NUKLEAR_DRAW_DEFAULT));
+        AssertNot(IsNuklearFrameChanged(NULL));
+        UnloadNuklear(ctx);
+    }
+
+    // UpdateNuklearEx() and ShouldNuklearRedraw()
+    {
+        ctx = InitNuklear(10);
+        Assert(ShouldNuklearRedraw(ctx), "Redraw right after initializing");
+
+        // Without input, the GUI settles after a few updates.
+        bool active = true;
+        for (int i = 0; i < 10; i++) {
+            active = UpdateNuklearEx(ctx, 1.0f / 60.0f);
+        }
+        AssertNot(active, "No input activity");
+        AssertNot(ShouldNuklearRedraw(ctx), "Idle without input");
+
+        // An auto-hiding scrollbar animates without input.
+        if (nk_begin(ctx, "Scroll", nk_rect(10, 10, 100, 100), NK_WINDOW_SCROLL_AUTO_HIDE)) {
+            nk_layout_row_dynamic(ctx, 20, 1);
+            nk_label(ctx, "Scrolling", NK_TEXT_LEFT);
+        }
+        nk_end(ctx);
+        Assert(ShouldNuklearRedraw(ctx), "Auto-hiding scrollbar animates");
+        nk_clear(ctx);
+
+        AssertNot(UpdateNuklear(NULL));
+        AssertNot(ShouldNuklearRedraw(NULL));
+        UnloadNuklear(ctx);
+    }
+
+    // InitNuklearFixed(), InitNuklearFixedEx(), GetNuklearMemoryStats()
+    {
+        static unsigned char memory[128 * 1024];
+        AssertEqual(InitNuklearFixed(NULL, sizeof(memory), 10), NULL);
+        AssertEqual(InitNuklearFixed(memory, 64, 10), NULL, "The memory is too small for the context");
+
+        ctx = InitNuklearFixed(memory, sizeof(memory), 10);
+        Assert(ctx);
+        Assert((unsigned char*)ctx >= memory && (unsigned char*)ctx < memory + sizeof(memory));
+        NuklearMemoryStats stats = GetNuklearMemoryStats(ctx);
+        AssertEqual(stats.arenaSize, sizeof(memory));
+        Assert(stats.arenaUsed > 0 && stats.arenaUsed <= stats.arenaSize);
+        AssertNot(stats.arenaOverflow);
+
+        for (int frame = 0; frame < 3; frame++) {
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "Fixed", nk_rect(0, 0, 200, 200), NK_WINDOW_TITLE)) {
+                nk_layout_row_dynamic(ctx, 20, 1);
+                nk_label(ctx, "Fixed memory", NK_TEXT_LEFT);
+                nk_raylib_label_wrap(ctx, "Wrapped text in fixed memory");
+            }
+            nk_end(ctx);
+            BeginDrawing();
+                DrawNuklear(ctx);
+                DrawNuklearBatched(ctx);
+            EndDrawing();
+        }
+        NuklearUserData* userData = (NuklearUserData*)ctx->userdata.ptr;
+        AssertEqual(userData->wrap_text_count, 0, "Text is wrapped without its cache");
+        AssertEqual(userData->text_runs.count, 0, "Text is drawn without the glyph cache");
+        stats = GetNuklearMemoryStats(ctx);
+        Assert(stats.arenaPeak > stats.arenaUsed, "The frame's commands are counted in the peak");
+        Assert(stats.arenaPeak <= stats.arenaSize);
+        AssertNot(stats.arenaOverflow);
+        UnloadNuklear(ctx);
+
+        // Commands that don't fit are dropped and reported.
+        static unsigned char small[24 * 1024];
+        ctx = InitNuklearFixed(small, sizeof(small), 10);
+        Assert(ctx);
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "Small", nk_rect(0, 0, 200, 4000), 0)) {
+            nk_layout_row_dynamic(ctx, 20, 1);
+            for (int i = 0; i < 1000; i++) {
+                nk_label(ctx, "A label that takes up command memory", NK_TEXT_LEFT);
+            }
+        }
+        nk_end(ctx);
+        stats = GetNuklearMemoryStats(ctx);
+        Assert(stats.arenaOverflow);
+        Assert(stats.arenaPeak <= stats.arenaSize);
+        BeginDrawing();
+            DrawNuklear(ctx);
+        EndDrawing();
+        Assert(GetNuklearMemoryStats(ctx).arenaOverflow, "Overflow stays reported");
+        UnloadNuklear(ctx);
+
+        // The font is kept in the memory too.
+        Font font = LoadFont("resources/anonymous_pro_bold.ttf");
+        ctx = InitNuklearFixedEx(memory, sizeof(memory), font, 16.0f);
+        Assert(ctx);
+        AssertEqual(ctx->style.font->height, 16.0f);
+        Assert((unsigned char*)ctx->style.font > memory && (unsigned char*)ctx->style.font < memory + sizeof(memory));
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "Font", nk_rect(0, 0, 200, 200), 0)) {
+            nk_layout_row_dynamic(ctx, 20, 1);
+            nk_label(ctx, "Font in fixed memory", NK_TEXT_LEFT);
+        }
+        nk_end(ctx);
+        BeginDrawing();
+            DrawNuklear(ctx);
+        EndDrawing();
+        UnloadNuklear(ctx);
+        UnloadFont(font);
+
+        // Contexts that allocate have no fixed memory to report.
+        ctx = InitNuklear(10);
+        AssertEqual(GetNuklearMemoryStats(ctx).arenaSize, 0);
+        UnloadNuklear(ctx);
+        AssertEqual(GetNuklearMemoryStats(NULL).arenaSize, 0);
+    }
+
+    // InitNuklearWithAllocator(), nk_raylib_textedit_init(), GetNuklearMemoryStats()
+    {
+        TestAllocator counts = {0};
+        NuklearAllocator allocator = {&counts, TestAllocatorAlloc, TestAllocatorResize, TestAllocatorFree};
+        struct nk_user_font* font = LoadNuklearFont(GetFontDefault(), 10.0f);
+        ctx = InitNuklearWithAllocator(font, &allocator);
+        Assert(ctx);
+        Assert(counts.allocations > 0);
+        NuklearMemoryStats stats = GetNuklearMemoryStats(ctx);
+        AssertEqual(stats.arenaSize, 0);
+        AssertEqual(stats.sourceBytes[NUKLEAR_MEMORY_COMMANDS], NK_DEFAULT_COMMAND_BUFFER_SIZE);
+        AssertEqual(stats.liveBytes, stats.sourceBytes[NUKLEAR_MEMORY_COMMANDS] + stats.sourceBytes[NUKLEAR_MEMORY_VERTEX_BUFFERS]);
+
+        // The first frames allocate pool pages and grow the command buffer, which the allocator does in place.
+        for (int frame = 0; frame < 4; frame++) {
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "Allocator", nk_rect(0, 0, 200, 4000), 0)) {
+                nk_layout_row_dynamic(ctx, 20, 1);
+                for (int i = 0; i < 200; i++) {
+                    nk_label(ctx, "A label that takes up command memory", NK_TEXT_LEFT);
+                }
+            }
+            nk_end(ctx);
+            BeginDrawing();
+                DrawNuklear(ctx);
+            EndDrawing();
+            stats = GetNuklearMemoryStats(ctx);
+            if (frame == 0) {
+                Assert(stats.frameAllocations > 0, "The first frame allocates pool pages");
+            }
+            else if (frame > 1) {
+                AssertEqual(stats.frameAllocations, 0, "Unchanged frames don't allocate");
+            }
+        }
+        Assert(stats.sourceBytes[NUKLEAR_MEMORY_COMMANDS] > NK_DEFAULT_COMMAND_BUFFER_SIZE);
+        Assert(stats.sourceBytes[NUKLEAR_MEMORY_POOL] > 0);
+        Assert(stats.sourceAllocations[NUKLEAR_MEMORY_POOL] > 0);
+        Assert(stats.reallocations > 0);
+        AssertEqual(stats.inPlaceReallocations, stats.reallocations, "Each growth fit the 64 KB blocks");
+        Assert(stats.peakBytes >= stats.liveBytes);
+
+        // Text edits are attributed to their own source.
+        struct nk_text_edit edit;
+        nk_raylib_textedit_init(ctx, &edit, 256);
+        AssertEqual(GetNuklearMemoryStats(ctx).sourceBytes[NUKLEAR_MEMORY_TEXT_EDIT], 256);
+        nk_textedit_text(&edit, "Hello", 5);
+        nk_textedit_free(&edit);
+        AssertEqual(GetNuklearMemoryStats(ctx).sourceBytes[NUKLEAR_MEMORY_TEXT_EDIT], 0);
+
+        UnloadNuklear(ctx);
+        AssertEqual(counts.allocations, counts.frees, "Every block is freed on unload");
+
+        // Without resize(), growing buffers are copied into new blocks.
+        allocator.resize = NULL;
+        ctx = InitNuklearWithAllocator(LoadNuklearFont(GetFontDefault(), 10.0f), &allocator);
+        UpdateNuklear(ctx);
+        if (nk_begin(ctx, "Copy", nk_rect(0, 0, 200, 4000), 0)) {
+            nk_layout_row_dynamic(ctx, 20, 1);
+            for (int i = 0; i < 200; i++) {
+                nk_label(ctx, "A label that takes up command memory", NK_TEXT_LEFT);
+            }
+        }
+        nk_end(ctx);
+        stats = GetNuklearMemoryStats(ctx);
+        Assert(stats.reallocations > 0);
+        AssertEqual(stats.inPlaceReallocations, 0);
+        UnloadNuklear(ctx);
+        AssertEqual(counts.allocations, counts.frees);
+
+        // Allocators need alloc and free.
+        allocator.free = NULL;
+        font = LoadNuklearFont(GetFontDefault(), 10.0f);
+        AssertEqual(InitNuklearWithAllocator(font, &allocator), NULL);
+        UnloadNuklearFont(font);
+
+        // Contexts from InitNuklear() count what raylib allocates for them.
+        ctx = InitNuklear(10);
+        Assert(GetNuklearMemoryStats(ctx).liveBytes >= NK_DEFAULT_COMMAND_BUFFER_SIZE);
+        UnloadNuklear(ctx);
+    }
+
+    // ReserveNuklearCommandBuffer(), SetNuklearCommandBufferShrinkFrames()
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+
+        // Prewarming resizes the empty command buffer right away.
+        ReserveNuklearCommandBuffer(ctx, 256 * 1024);
+        AssertEqual(GetNuklearMemoryStats(ctx).commandBufferSize, 256 * 1024);
+        ReserveNuklearCommandBuffer(ctx, 0);
+        SetNuklearCommandBufferShrinkFrames(ctx, 5);
+
+        // A single heavy frame grows the buffer, which shrinks again once the spike is rare in the recent frames.
+        nk_size heavy = 0;
+        for (int frame = 0; frame < 40; frame++) {
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "Spike", nk_rect(0, 0, 200, 8000), 0)) {
+                nk_layout_row_dynamic(ctx, 20, 1);
+                for (int i = 0; i < ((frame == 0) ? 400 : 2); i++) {
+                    nk_label(ctx, "A label that takes up command memory", NK_TEXT_LEFT);
+                }
+            }
+            nk_end(ctx);
+            if (frame == 0) {
+                heavy = ctx->memory.needed;
+            }
+            BeginDrawing();
+                DrawNuklear(ctx);
+            EndDrawing();
+        }
+        NuklearMemoryStats stats = GetNuklearMemoryStats(ctx);
+        Assert(heavy > 4 * NK_DEFAULT_COMMAND_BUFFER_SIZE, "The heavy frame needed %i bytes", (int)heavy);
+        AssertEqual(stats.commandBufferTarget, NK_DEFAULT_COMMAND_BUFFER_SIZE);
+        AssertEqual(stats.commandBufferSize, NK_DEFAULT_COMMAND_BUFFER_SIZE, "The buffer shrank after the spike");
+        AssertEqual(stats.frameAllocations, 0);
+
+        // The buffer doesn't shrink below the reserved size.
+        ReserveNuklearCommandBuffer(ctx, 32 * 1024);
+        for (int frame = 0; frame < 10; frame++) {
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "Spike", nk_rect(0, 0, 200, 8000), 0)) {
+                nk_layout_row_dynamic(ctx, 20, 1);
+                nk_label(ctx, "Light", NK_TEXT_LEFT);
+            }
+            nk_end(ctx);
+            BeginDrawing();
+                DrawNuklear(ctx);
+            EndDrawing();
+        }
+        AssertEqual(GetNuklearMemoryStats(ctx).commandBufferSize, 32 * 1024);
+
+        // Without shrinking, the buffer keeps its size.
+        ReserveNuklearCommandBuffer(ctx, 0);
+        SetNuklearCommandBufferShrinkFrames(ctx, 0);
+        for (int frame = 0; frame < 10; frame++) {
+            UpdateNuklear(ctx);
+            BeginDrawing();
+                DrawNuklear(ctx);
+            EndDrawing();
+        }
+        AssertEqual(GetNuklearMemoryStats(ctx).commandBufferSize, 32 * 1024);
+
+        ReserveNuklearCommandBuffer(NULL, 1024);
+        SetNuklearCommandBufferShrinkFrames(NULL, 1);
+        UnloadNuklear(ctx);
+    }
+
+    // nk_raylib_tree_push(), nk_raylib_tree_push_hashed(), nk_raylib_group_begin()
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+        NuklearStateIndex* states = &((NuklearUserData*)ctx->userdata.ptr)->states;
+        AssertNot(nk_raylib_tree_push(ctx, NK_TREE_NODE, "Outside", NK_MAXIMIZED), "Trees need a window");
+
+        for (int frame = 0; frame < 3; frame++) {
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "Tree", nk_rect(0, 0, 300, 400), 0)) {
+                nk_bool expanded = nk_raylib_tree_push(ctx, NK_TREE_NODE, "Root", NK_MAXIMIZED);
+                Assert(expanded, "The root keeps its state on frame %i", frame);
+                if (expanded) {
+                    // Nodes that share a title are told apart by their id, across several pages of states.
+                    for (int i = 0; i < 3000; i++) {
+                        if (nk_raylib_tree_push_hashed(ctx, NK_TREE_NODE, "Node", NK_MINIMIZED, "Nodes", 5, i)) {
+                            Assert(frame > 0 && i == 7, "Only the expanded node is open");
+                            nk_tree_pop(ctx);
+                        }
+                    }
+                    nk_tree_pop(ctx);
+                }
+
+                nk_layout_row_dynamic(ctx, 100, 1);
+                if (nk_raylib_group_begin(ctx, "Group", 0)) {
+                    NuklearWidgetState* group = raylib_nuklear_find_state(states, ctx->current->name, raylib_nuklear_hash_id(NULL, "Group", 5, NK_PANEL_GROUP));
+                    Assert(group);
+                    Assert(ctx->current->layout->offset_y == &group->values[1], "The group scrolls its indexed offsets");
+                    nk_layout_row_dynamic(ctx, 20, 1);
+                    nk_label(ctx, "Grouped", NK_TEXT_LEFT);
+                    nk_group_end(ctx);
+                }
+            }
+            nk_end(ctx);
+
+            // Expand one of the nodes, as a click on it would.
+            if (frame == 0) {
+                nk_hash window = nk_murmur_hash("Tree", 4, NK_WINDOW_TITLE);
+                NuklearWidgetState* node = raylib_nuklear_find_state(states, window, raylib_nuklear_hash_id(NULL, "Nodes", 5, 7));
+                Assert(node);
+                AssertEqual(node->values[0], NK_MINIMIZED);
+                node->values[0] = NK_MAXIMIZED;
+            }
+
+            BeginDrawing();
+                DrawNuklear(ctx);
+            EndDrawing();
+        }
+        AssertEqual(states->count, 3002, "The root, the nodes and the group have one state each");
+        AssertEqual(states->windowCount, 1);
+
+        // The states are dropped along with their window.
+        for (int frame = 0; frame < 2; frame++) {
+            UpdateNuklear(ctx);
+            BeginDrawing();
+                DrawNuklear(ctx);
+            EndDrawing();
+        }
+        AssertEqual(states->count, 0);
+        AssertEqual(states->windowCount, 0);
         UnloadNuklear(ctx);
     }
 
+    // nk_raylib_tree_push() in a popup keeps its state with the popup's window
+    {
+        ctx = InitNuklear(10);
+        Assert(ctx);
+        NuklearStateIndex* states = &((NuklearUserData*)ctx->userdata.ptr)->states;
+
+        for (int frame = 0; frame < 3; frame++) {
+            UpdateNuklear(ctx);
+            if (nk_begin(ctx, "Window", nk_rect(0, 0, 300, 400), 0)) {
+                nk_layout_row_dynamic(ctx, 20, 1);
+                AssertNot(nk_raylib_tree_push(ctx, NK_TREE_NODE, "Item", NK_MINIMIZED), "The window's node is another node");
+                if (nk_popup_begin(ctx, NK_POPUP_STATIC, "Popup", 0, nk_rect(10, 40, 200, 200))) {
+                    nk_layout_row_dynamic(ctx, 20, 1);
+                    nk_bool expanded = nk_raylib_tree_push(ctx, NK_TREE_NODE, "Item", NK_MINIMIZED);
+                    AssertEqual(expanded, frame > 0, "The popup's node keeps its state on frame %i", frame);
+                    if (expanded) {
+                        nk_tree_pop(ctx);
+                    }
+                    nk_popup_end(ctx);
+                }
+            }
+            nk_end(ctx);
+
+            // Expand the popup's node, as a click on it would.
+            AssertEqual(states->count, 2);
+            AssertEqual(states->windowCount, 1);
+            AssertEqual(states->windows[0], nk_murmur_hash("Window", 6, NK_WINDOW_TITLE));
+            if (frame == 0) {
+                raylib_nuklear_state_at(states, 1)->values[0] = NK_MAXIMIZED;
+            }
+
+            BeginDrawing();
+                DrawNuklear(ctx);
+            EndDrawing();
+        }
+
+        // UpdateNuklear() drops the states of windows that are gone, even when frames are cleared without drawing them.
+        for (int frame = 0; frame < 2; frame++) {
+            UpdateNuklear(ctx);
+            nk_clear(ctx);
+        }
+        UpdateNuklear(ctx);
+        AssertEqual(states->count, 0);
+        AssertEqual(states->windowCount, 0);
+        nk_clear(ctx);
+        UnloadNuklear(ctx);
+    }
+
+    // raylib_nuklear_hash_id()
+    {
+        // IDs only depend on the string and the seed, to be the same across runs.
+        AssertEqual(raylib_nuklear_hash_id(NULL, "", 0, 0), 4145160958u);
+        AssertEqual(raylib_nuklear_hash_id(NULL, "Tree", 4, 1), 958792989u);
+        AssertEqual(raylib_nuklear_hash_id(NULL, "Window", 6, NK_WINDOW_TITLE), 210647870u);
+        AssertEqual(raylib_nuklear_hash_id(NULL, "path/to/some/source/file.c:1234", 31, 1234), 1090666323u);
+
+        // Every length and seed gives a different ID.
+        char text[160];
+        for (int i = 0; i < 160; i++) {
+            text[i] = 'a';
+        }
+        for (int len = 1; len < 160; len++) {
+            AssertNotEqual(raylib_nuklear_hash_id(NULL, text, len, 0), raylib_nuklear_hash_id(NULL, text, len - 1, 0));
+            AssertNotEqual(raylib_nuklear_hash_id(NULL, text, len, 0), raylib_nuklear_hash_id(NULL, text, len, 1));
+        }
+
+        // The memo gives the same IDs, and notices strings that changed at the same address.
+        NuklearHashMemo memo = {0};
+        memo.frame = 1;
+        nk_hash first = raylib_nuklear_hash_id(&memo, text, 150, 3);
+        AssertEqual(raylib_nuklear_hash_id(&memo, text, 150, 3), first);
+        AssertEqual(raylib_nuklear_hash_id(&memo, text, 150, 4), raylib_nuklear_hash_id(NULL, text, 150, 4));
+        AssertEqual(memo.misses, 1);
+        AssertEqual(memo.hits, 2, "Other seeds reuse the string's hash");
+        text[75] = 'b';
+        AssertNotEqual(raylib_nuklear_hash_id(&memo, text, 150, 3), first);
+        AssertEqual(raylib_nuklear_hash_id(&memo, text, 150, 3), raylib_nuklear_hash_id(NULL, text, 150, 3));
+        AssertEqual(memo.misses, 2);
+        AssertEqual(raylib_nuklear_hash_id(&memo, text, 40, 3), raylib_nuklear_hash_id(NULL, text, 40, 3));
+        AssertEqual(memo.misses, 2, "Short IDs are hashed without the memo");
+
+        // Strings from the previous frame are hashed again.
+        memo.frame++;
+        memo.copySize = 0;
+        raylib_nuklear_hash_id(&memo, text, 150, 3);
+        AssertEqual(memo.misses, 3);
+        MemFree(memo.entries);
+        MemFree(memo.copies);
+    }
+
     // A NULL context must not crash any of the public entry points.
     {
         UpdateNuklear(NULL);
         UpdateNuklearEx(NULL, 1.0f / 60.0f);
         DrawNuklear(NULL);
+        DrawNuklearBatched(NULL);
         SetNuklearScaling(NULL, 2.0f);
         AssertEqual(GetNuklearScaling(NULL), 1.0f);
         UnloadNuklear(NULL);